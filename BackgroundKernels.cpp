@@ -0,0 +1,172 @@
+// Contains the vectorized per row kernels behind BackgroundRemover for Hand Detection. Each kernel
+//  compares a row of the frame against the same row of the background and writes the binary mask.
+//  An AVX2, an SSE2 and a portable version exist, the fastest one the CPU supports is picked at runtime.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/types.hpp>
+#include <cstdlib>
+#include "Hand.h"
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define HAND_X86_SIMD 1
+#include <immintrin.h>
+#endif
+#if defined(__GNUC__)
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_AVX2
+#endif
+using namespace cv;
+using namespace std;
+
+typedef void (*DiffRowKernel)(const uchar*, const uchar*, uchar*, int, int, int);
+
+
+// BackgroundDiffRowScalar
+// Precondition: front and back point to width BGR pixels, mask points to width bytes
+// Postcondition: mask is 255 where a pixel differs from the background by at least thresh in one of
+//                its channels and passes the skin test (red at least red_thresh, or red above both
+//                blue and green). A red_thresh of 0 turns the skin test off.
+void BackgroundDiffRowScalar(const uchar* front, const uchar* back, uchar* mask, int width,
+	int thresh, int red_thresh) {
+	for (int col = 0; col < width; col++, front += 3, back += 3) {
+		int blue = front[0];
+		int green = front[1];
+		int red = front[2];
+		int moved = (abs(blue - back[0]) >= thresh) | (abs(green - back[1]) >= thresh) |
+			(abs(red - back[2]) >= thresh);
+		int skin = (red >= red_thresh) | ((red > blue) & (red > green));
+		mask[col] = uchar(-(moved & skin));
+	}
+}
+
+#ifdef HAND_X86_SIMD
+// Splits 16 packed BGR pixels into one register per channel using only SSE2 unpacks
+static inline void LoadDeinterleaveSSE2(const uchar* ptr, __m128i& blue, __m128i& green, __m128i& red) {
+	__m128i t00 = _mm_loadu_si128((const __m128i*)ptr);
+	__m128i t01 = _mm_loadu_si128((const __m128i*)(ptr + 16));
+	__m128i t02 = _mm_loadu_si128((const __m128i*)(ptr + 32));
+
+	__m128i t10 = _mm_unpacklo_epi8(t00, _mm_unpackhi_epi64(t01, t01));
+	__m128i t11 = _mm_unpacklo_epi8(_mm_unpackhi_epi64(t00, t00), t02);
+	__m128i t12 = _mm_unpacklo_epi8(t01, _mm_unpackhi_epi64(t02, t02));
+
+	__m128i t20 = _mm_unpacklo_epi8(t10, _mm_unpackhi_epi64(t11, t11));
+	__m128i t21 = _mm_unpacklo_epi8(_mm_unpackhi_epi64(t10, t10), t12);
+	__m128i t22 = _mm_unpacklo_epi8(t11, _mm_unpackhi_epi64(t12, t12));
+
+	__m128i t30 = _mm_unpacklo_epi8(t20, _mm_unpackhi_epi64(t21, t21));
+	__m128i t31 = _mm_unpacklo_epi8(_mm_unpackhi_epi64(t20, t20), t22);
+	__m128i t32 = _mm_unpacklo_epi8(t21, _mm_unpackhi_epi64(t22, t22));
+
+	blue = _mm_unpacklo_epi8(t30, _mm_unpackhi_epi64(t31, t31));
+	green = _mm_unpacklo_epi8(_mm_unpackhi_epi64(t30, t30), t32);
+	red = _mm_unpacklo_epi8(t31, _mm_unpackhi_epi64(t32, t32));
+}
+
+// BackgroundDiffRowSSE2
+// Precondition: Same as BackgroundDiffRowScalar
+// Postcondition: Same as BackgroundDiffRowScalar, 16 pixels at a time
+void BackgroundDiffRowSSE2(const uchar* front, const uchar* back, uchar* mask, int width,
+	int thresh, int red_thresh) {
+	const __m128i thresh_v = _mm_set1_epi8(char(thresh));
+	const __m128i red_thresh_v = _mm_set1_epi8(char(red_thresh));
+	const __m128i sign = _mm_set1_epi8(char(0x80));
+	int col = 0;
+	for (; col + 16 <= width; col += 16) {
+		__m128i front_b, front_g, front_r, back_b, back_g, back_r;
+		LoadDeinterleaveSSE2(front + col * 3, front_b, front_g, front_r);
+		LoadDeinterleaveSSE2(back + col * 3, back_b, back_g, back_r);
+
+		__m128i diff = _mm_or_si128(_mm_subs_epu8(front_b, back_b), _mm_subs_epu8(back_b, front_b));
+		diff = _mm_max_epu8(diff, _mm_or_si128(_mm_subs_epu8(front_g, back_g), _mm_subs_epu8(back_g, front_g)));
+		diff = _mm_max_epu8(diff, _mm_or_si128(_mm_subs_epu8(front_r, back_r), _mm_subs_epu8(back_r, front_r)));
+		__m128i moved = _mm_cmpeq_epi8(_mm_max_epu8(diff, thresh_v), diff);
+
+		__m128i red_high = _mm_cmpeq_epi8(_mm_max_epu8(front_r, red_thresh_v), front_r);
+		__m128i red_signed = _mm_xor_si128(front_r, sign);
+		__m128i red_most = _mm_and_si128(
+			_mm_cmpgt_epi8(red_signed, _mm_xor_si128(front_b, sign)),
+			_mm_cmpgt_epi8(red_signed, _mm_xor_si128(front_g, sign)));
+		__m128i result = _mm_and_si128(moved, _mm_or_si128(red_high, red_most));
+		_mm_storeu_si128((__m128i*)(mask + col), result);
+	}
+	BackgroundDiffRowScalar(front + col * 3, back + col * 3, mask + col, width - col, thresh, red_thresh);
+}
+
+// Splits 32 packed BGR pixels into one register per channel
+TARGET_AVX2 static inline void LoadDeinterleaveAVX2(const uchar* ptr, __m256i& blue, __m256i& green,
+	__m256i& red) {
+	__m256i bgr0 = _mm256_loadu_si256((const __m256i*)ptr);
+	__m256i bgr1 = _mm256_loadu_si256((const __m256i*)(ptr + 32));
+	__m256i bgr2 = _mm256_loadu_si256((const __m256i*)(ptr + 64));
+	__m256i s02_low = _mm256_permute2x128_si256(bgr0, bgr2, 0 + 2 * 16);
+	__m256i s02_high = _mm256_permute2x128_si256(bgr0, bgr2, 1 + 3 * 16);
+
+	const __m256i m0 = _mm256_setr_epi8(0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0,
+		0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0);
+	const __m256i m1 = _mm256_setr_epi8(0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0,
+		-1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1);
+	__m256i b0 = _mm256_blendv_epi8(_mm256_blendv_epi8(s02_low, s02_high, m0), bgr1, m1);
+	__m256i g0 = _mm256_blendv_epi8(_mm256_blendv_epi8(s02_high, s02_low, m1), bgr1, m0);
+	__m256i r0 = _mm256_blendv_epi8(_mm256_blendv_epi8(bgr1, s02_low, m0), s02_high, m1);
+
+	const __m256i shuffle_b = _mm256_setr_epi8(0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13,
+		0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13);
+	const __m256i shuffle_g = _mm256_setr_epi8(1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14,
+		1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14);
+	const __m256i shuffle_r = _mm256_setr_epi8(2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15,
+		2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15);
+	blue = _mm256_shuffle_epi8(b0, shuffle_b);
+	green = _mm256_shuffle_epi8(g0, shuffle_g);
+	red = _mm256_shuffle_epi8(r0, shuffle_r);
+}
+
+// BackgroundDiffRowAVX2
+// Precondition: Same as BackgroundDiffRowScalar, and the CPU supports AVX2
+// Postcondition: Same as BackgroundDiffRowScalar, 32 pixels at a time
+TARGET_AVX2 void BackgroundDiffRowAVX2(const uchar* front, const uchar* back, uchar* mask, int width,
+	int thresh, int red_thresh) {
+	const __m256i thresh_v = _mm256_set1_epi8(char(thresh));
+	const __m256i red_thresh_v = _mm256_set1_epi8(char(red_thresh));
+	const __m256i sign = _mm256_set1_epi8(char(0x80));
+	int col = 0;
+	for (; col + 32 <= width; col += 32) {
+		__m256i front_b, front_g, front_r, back_b, back_g, back_r;
+		LoadDeinterleaveAVX2(front + col * 3, front_b, front_g, front_r);
+		LoadDeinterleaveAVX2(back + col * 3, back_b, back_g, back_r);
+
+		__m256i diff = _mm256_or_si256(_mm256_subs_epu8(front_b, back_b), _mm256_subs_epu8(back_b, front_b));
+		diff = _mm256_max_epu8(diff, _mm256_or_si256(_mm256_subs_epu8(front_g, back_g), _mm256_subs_epu8(back_g, front_g)));
+		diff = _mm256_max_epu8(diff, _mm256_or_si256(_mm256_subs_epu8(front_r, back_r), _mm256_subs_epu8(back_r, front_r)));
+		__m256i moved = _mm256_cmpeq_epi8(_mm256_max_epu8(diff, thresh_v), diff);
+
+		__m256i red_high = _mm256_cmpeq_epi8(_mm256_max_epu8(front_r, red_thresh_v), front_r);
+		__m256i red_signed = _mm256_xor_si256(front_r, sign);
+		__m256i red_most = _mm256_and_si256(
+			_mm256_cmpgt_epi8(red_signed, _mm256_xor_si256(front_b, sign)),
+			_mm256_cmpgt_epi8(red_signed, _mm256_xor_si256(front_g, sign)));
+		__m256i result = _mm256_and_si256(moved, _mm256_or_si256(red_high, red_most));
+		_mm256_storeu_si256((__m256i*)(mask + col), result);
+	}
+	BackgroundDiffRowSSE2(front + col * 3, back + col * 3, mask + col, width - col, thresh, red_thresh);
+}
+#endif
+
+// Picks the widest kernel the CPU running the program supports
+static DiffRowKernel SelectDiffRowKernel() {
+#ifdef HAND_X86_SIMD
+	if (checkHardwareSupport(CPU_AVX2)) return BackgroundDiffRowAVX2;
+	if (checkHardwareSupport(CPU_SSE2)) return BackgroundDiffRowSSE2;
+#endif
+	return BackgroundDiffRowScalar;
+}
+
+// BackgroundDiffRow
+// Precondition: Same as BackgroundDiffRowScalar
+// Postcondition: Same as BackgroundDiffRowScalar, using the fastest kernel for this CPU
+void BackgroundDiffRow(const uchar* front, const uchar* back, uchar* mask, int width,
+	int thresh, int red_thresh) {
+	static const DiffRowKernel kernel = SelectDiffRowKernel();
+	kernel(front, back, mask, width, thresh, red_thresh);
+}
@@ -0,0 +1,103 @@
+// Contains the descriptor benchmark for the template matching of Hand Detection. The template index is
+//  built with SIFT, ORB and BRISK, and each one classifies the numbered template pictures and frames
+//  of the bundled videos. The time per picture and how often each agrees with SIFT are printed.
+//  Build together with ../TemplateIndex.cpp and ../HammingKernels.cpp.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/features2d.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/videoio.hpp>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <stdio.h>
+#include "../Hand.h"
+#include "../TemplateIndex.h"
+using namespace cv;
+using namespace std;
+
+string const template_path = "../Templates/hand";
+string const picture_path = "../Templates/";
+vector<string> const video_paths = { "../india.mp4", "../Updated/hand.mp4" };
+int const frames_per_video = 20;
+int const similarity_threshold = 10;
+
+bool BuildTemplateIndex(TemplateIndex& index, const string& template_path, const string& cache_file,
+	const TemplateDescriptor descriptor);
+TemplateMatch MatchTemplateIndex(const TemplateIndex& index, const Mat& object);
+
+
+// LoadBenchPictures
+// Precondition: None
+// Postcondition: Returns the numbered template pictures followed by frames spread evenly through each
+//                bundled video. Pictures or videos that can not be read are left out.
+vector<Mat> LoadBenchPictures() {
+	vector<Mat> pictures;
+	for (int i = 0; ; i++) {
+		Mat picture = imread(picture_path + to_string(i) + ".jpg");
+		if (picture.empty()) break;
+		pictures.push_back(picture);
+	}
+	for (size_t v = 0; v < video_paths.size(); v++) {
+		VideoCapture video(video_paths[v]);
+		if (!video.isOpened()) continue;
+		int const frame_count = max(1, (int)video.get(CAP_PROP_FRAME_COUNT));
+		for (int i = 0; i < frames_per_video; i++) {
+			Mat frame;
+			video.set(CAP_PROP_POS_FRAMES, (double)i * frame_count / frames_per_video);
+			video >> frame;
+			if (!frame.empty()) pictures.push_back(frame);
+		}
+	}
+	return pictures;
+}
+
+// Main Method - Benchmark
+// Precondition: The templates and videos are where the program keeps them, one directory up
+// Postcondition: For each kind of descriptor the time to build the index, the median time to classify
+//                a picture and the share of pictures classified the same as with SIFT are printed
+int main() {
+	vector<Mat> pictures = LoadBenchPictures();
+	if (pictures.empty()) {
+		cout << "No pictures to classify" << endl;
+		return -1;
+	}
+
+	vector<TemplateDescriptor> descriptors = { SIFT_DESCRIPTOR, ORB_DESCRIPTOR, BRISK_DESCRIPTOR };
+	vector<string> names = { "SIFT", "ORB", "BRISK" };
+	vector<int> sift_types;
+
+	printf("%d pictures\n%-8s %12s %14s %10s\n", (int)pictures.size(), "", "build ms", "classify ms",
+		"agreement");
+	for (size_t d = 0; d < descriptors.size(); d++) {
+		TemplateIndex index;
+		int64 start = getTickCount();
+		// No cache file, so the build time includes working out the template descriptors
+		if (!BuildTemplateIndex(index, template_path, "", descriptors[d])) {
+			cout << "No templates found at " << template_path << endl;
+			return -1;
+		}
+		double build_ms = (getTickCount() - start) * 1000.0 / getTickFrequency();
+
+		vector<double> times;
+		vector<int> types;
+		for (size_t i = 0; i < pictures.size(); i++) {
+			start = getTickCount();
+			TemplateMatch match = MatchTemplateIndex(index, pictures[i]);
+			times.push_back((getTickCount() - start) * 1000.0 / getTickFrequency());
+			types.push_back(match.score >= similarity_threshold ? match.index : -1);
+		}
+		sort(times.begin(), times.end());
+		if (descriptors[d] == SIFT_DESCRIPTOR) sift_types = types;
+
+		int agree = 0;
+		for (size_t i = 0; i < types.size(); i++) {
+			if (types[i] == sift_types[i]) agree++;
+		}
+		printf("%-8s %12.1f %14.2f %9.1f%%\n", names[d].c_str(), build_ms, times[times.size() / 2],
+			100.0 * agree / types.size());
+	}
+	return 0;
+}
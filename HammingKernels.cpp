@@ -0,0 +1,109 @@
+// Contains the Hamming distance kernels behind the binary descriptor template matching of Hand
+//  Detection. Each kernel counts the bits that differ between two descriptors. An AVX2 and a portable
+//  version exist, the fastest one the CPU supports is picked at runtime.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/types.hpp>
+#include <climits>
+#include <cstring>
+#include <stdint.h>
+#include "Hand.h"
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define HAND_X86_SIMD 1
+#include <immintrin.h>
+#endif
+#if defined(__GNUC__)
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_AVX2
+#endif
+using namespace cv;
+using namespace std;
+
+typedef int (*HammingKernel)(const uchar*, const uchar*, int);
+
+
+// CountBits
+// Precondition: None
+// Postcondition: Returns the number of set bits in value
+static inline int CountBits(uint64_t value) {
+	value = value - ((value >> 1) & 0x5555555555555555ULL);
+	value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+	value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return (int)((value * 0x0101010101010101ULL) >> 56);
+}
+
+// HammingDistanceScalar
+// Precondition: a and b point to descriptors of bytes bytes each
+// Postcondition: Returns the number of bits that differ between a and b
+int HammingDistanceScalar(const uchar* a, const uchar* b, int bytes) {
+	int distance = 0;
+	int i = 0;
+	for (; i + 8 <= bytes; i += 8) {
+		uint64_t word_a, word_b;
+		memcpy(&word_a, a + i, 8);
+		memcpy(&word_b, b + i, 8);
+		distance += CountBits(word_a ^ word_b);
+	}
+	for (; i < bytes; i++) {
+		distance += CountBits(uint64_t(a[i] ^ b[i]));
+	}
+	return distance;
+}
+
+#ifdef HAND_X86_SIMD
+// HammingDistanceAVX2
+// Precondition: Same as HammingDistanceScalar, and the CPU supports AVX2
+// Postcondition: Same as HammingDistanceScalar, 32 bytes at a time. The bits of each byte are counted
+//                by looking up both of its halves in a 16 entry table.
+TARGET_AVX2 int HammingDistanceAVX2(const uchar* a, const uchar* b, int bytes) {
+	const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+		0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+	const __m256i low_mask = _mm256_set1_epi8(0x0F);
+	__m256i total = _mm256_setzero_si256();
+	int i = 0;
+	for (; i + 32 <= bytes; i += 32) {
+		__m256i diff = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(a + i)),
+			_mm256_loadu_si256((const __m256i*)(b + i)));
+		__m256i low = _mm256_shuffle_epi8(table, _mm256_and_si256(diff, low_mask));
+		__m256i high = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(diff, 4), low_mask));
+		total = _mm256_add_epi64(total, _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256()));
+	}
+	__m128i sum = _mm_add_epi64(_mm256_castsi256_si128(total), _mm256_extracti128_si256(total, 1));
+	sum = _mm_add_epi64(sum, _mm_unpackhi_epi64(sum, sum));
+	return _mm_cvtsi128_si32(sum) + HammingDistanceScalar(a + i, b + i, bytes - i);
+}
+#endif
+
+// Picks the widest kernel the CPU running the program supports
+static HammingKernel SelectHammingKernel() {
+#ifdef HAND_X86_SIMD
+	if (checkHardwareSupport(CPU_AVX2)) return HammingDistanceAVX2;
+#endif
+	return HammingDistanceScalar;
+}
+
+// HammingNearestTwo
+// Precondition: query points to one descriptor, train holds one descriptor of the same size per row
+//               as CV_8U
+// Postcondition: nearest is the row of train closest to query, and best and second are the distances
+//                to the closest and second closest rows. Distances with no row are INT_MAX.
+void HammingNearestTwo(const uchar* query, const Mat& train, int& nearest, int& best, int& second) {
+	static const HammingKernel kernel = SelectHammingKernel();
+	int const bytes = train.cols;
+	nearest = -1;
+	best = INT_MAX;
+	second = INT_MAX;
+	for (int row = 0; row < train.rows; row++) {
+		int distance = kernel(query, train.ptr<uchar>(row), bytes);
+		if (distance < best) {
+			second = best;
+			best = distance;
+			nearest = row;
+		}
+		else if (distance < second) {
+			second = distance;
+		}
+	}
+}
@@ -13,6 +13,7 @@
 #include <opencv2/videoio.hpp>
 #include <opencv2/video.hpp>
 #include "Hand.h"
+#include "Updated/Parallel.h"
 using namespace cv;
 using namespace std;
 
@@ -29,47 +30,57 @@ int const gaus_blur_amount = 3;
 int const median_blur = 7;
 int const brightness_level = 12;
 int const number_random_frames = 80;
+int const sample_seek_distance = 30;	// Sampled frames farther ahead than this are seeked to, nearer ones grabbed
 int const background_remover_thresh = 18;
 
 int FixComputedColor(double num);
+void BackgroundDiffRow(const uchar* front, const uchar* back, uchar* mask, int width,
+	int thresh, int red_thresh);
 
 // ModifyContrast
 // Precondition: test.jpg exists in the code directory and is a valid JPG.
 // Postcondition: output.jpg will be saved to disk with all of the contrast
 //                being enhanced
 void ModifyContrast(Mat& pic) {
-	double ave_blue = 0;
-	double ave_green = 0;
-	double ave_red = 0;
-
-	for (int row = 0; row < pic.rows; row++) {
-		for (int col = 0; col < pic.cols; col++) {
-			ave_blue += pic.at<Vec3b>(row, col)[0];
-			ave_green += pic.at<Vec3b>(row, col)[1];
-			ave_red += pic.at<Vec3b>(row, col)[2];
+	// Each band sums its own rows, the bands are added after so the mean is the same as one pass
+	int const bands = RowBands(pic.rows);
+	vector<int64> band_sums(bands * 3, 0);
+	ParallelRowBands(pic.rows, bands, [&](int band, int start_row, int end_row) {
+		int64* sums = &band_sums[band * 3];
+		for (int row = start_row; row < end_row; row++) {
+			const uchar* pixel = pic.ptr<uchar>(row);
+			for (int col = 0; col < pic.cols * 3; col += 3) {
+				sums[0] += pixel[col];
+				sums[1] += pixel[col + 1];
+				sums[2] += pixel[col + 2];
+			}
 		}
+	});
+	double average[3] = {0, 0, 0};
+	for (int band = 0; band < bands; band++) {
+		for (int channel = 0; channel < 3; channel++) average[channel] += (double)band_sums[band * 3 + channel];
 	}
 
-	ave_blue = ave_blue / pic.total();
-	ave_green = ave_green / pic.total();
-	ave_red = ave_red / pic.total();
-
-	for (int row = 0; row < pic.rows; row++) {
-		for (int col = 0; col < pic.cols; col++) {
-			double new_blue = ave_blue - double(pic.at<Vec3b>(row, col)[0]);
-			new_blue = ave_blue - (new_blue * contrast_num);
-
-			double new_green = ave_green - double(pic.at<Vec3b>(row, col)[1]);
-			new_green = ave_green - (new_green * contrast_num);
-
-			double new_red = ave_red - double(pic.at<Vec3b>(row, col)[2]);
-			new_red = ave_red - (new_red * contrast_num);
-
-			pic.at<Vec3b>(row, col)[0] = FixComputedColor(new_blue);
-			pic.at<Vec3b>(row, col)[1] = FixComputedColor(new_green);
-			pic.at<Vec3b>(row, col)[2] = FixComputedColor(new_red);
+	// Every pixel value of a channel maps to one result, so it is worked out once per value
+	uchar table[3][256];
+	for (int channel = 0; channel < 3; channel++) {
+		average[channel] = average[channel] / pic.total();
+		for (int value = 0; value < 256; value++) {
+			double new_color = average[channel] - double(value);
+			new_color = average[channel] - (new_color * contrast_num);
+			table[channel][value] = (uchar)FixComputedColor(new_color);
 		}
 	}
+	ParallelRows(pic.rows, [&](int start_row, int end_row) {
+		for (int row = start_row; row < end_row; row++) {
+			uchar* pixel = pic.ptr<uchar>(row);
+			for (int col = 0; col < pic.cols * 3; col += 3) {
+				pixel[col] = table[0][pixel[col]];
+				pixel[col + 1] = table[1][pixel[col + 1]];
+				pixel[col + 2] = table[2][pixel[col + 2]];
+			}
+		}
+	});
 }
 
 // Increases the saturation in each pixel in the given image, using saturation value in HSV
@@ -78,13 +89,14 @@ void ModifyContrast(Mat& pic) {
 void IncreaseSaturation(Mat& image) {
 	Mat saturated;
 	cvtColor(image, saturated, COLOR_BGR2HSV);
-	for (int row = 0; row < saturated.rows; row++) {
-		for (int col = 0; col < saturated.cols; col++) {
-			double originalSaturation = (double)saturated.at<Vec3b>(row, col)[1];
-			int newVal = FixComputedColor(originalSaturation + sat_val);
-			saturated.at<Vec3b>(row, col)[1] = newVal;
+	uchar table[256];
+	for (int value = 0; value < 256; value++) table[value] = (uchar)FixComputedColor(double(value) + sat_val);
+	ParallelRows(saturated.rows, [&](int start_row, int end_row) {
+		for (int row = start_row; row < end_row; row++) {
+			uchar* pixel = saturated.ptr<uchar>(row);
+			for (int col = 1; col < saturated.cols * 3; col += 3) pixel[col] = table[pixel[col]];
 		}
-	}
+	});
 	cvtColor(saturated, image, COLOR_HSV2BGR);
 }
 
@@ -114,102 +126,116 @@ void PrepareImage(Mat& image, bool is_background) {
 	//test++;
 }
 
+// PickSampleFrames
+// Precondition: number_of_frames and samples are positive
+// Postcondition: Returns up to samples distinct random frame indices in increasing order, so the
+//                video can be read front to back while collecting them
+vector<int> PickSampleFrames(int const number_of_frames, int const samples) {
+	vector<bool> chosen(number_of_frames, false);
+	vector<int> random_frames;
+	int const wanted = std::min(samples, number_of_frames);
+	while ((int)random_frames.size() < wanted) {
+		int random_frame = rand() % number_of_frames;
+		if (!chosen[random_frame]) {
+			chosen[random_frame] = true;
+			random_frames.push_back(random_frame);
+		}
+	}
+	sort(random_frames.begin(), random_frames.end());
+	return random_frames;
+}
+
+// ReadFrameAt
+// Precondition: video is correctly formatted and allocated, position is the index of the next frame
+//               video will return
+// Postcondition: frame holds the frame at index target and position is moved past it. Nearby frames
+//                are reached by grabbing without decoding, far ones by seeking. Returns false when
+//                the video ends first.
+bool ReadFrameAt(VideoCapture& video, int& position, int const target, Mat& frame) {
+	if (target - position > sample_seek_distance) {
+		video.set(CAP_PROP_POS_FRAMES, target);
+		position = target;
+	}
+	for (; position < target; position++) {
+		if (!video.grab()) return false;
+	}
+	video >> frame;
+	position++;
+	return !frame.empty();
+}
+
 // Detects and extracts the background from given video
 // preconditions: video is correctly formatted and allocated
-// postconditions: the calculated background from the video is returned as a Mat
+// postconditions: the calculated background from the video is returned as a Mat. The sampled
+//                 frames are read in order, grabbing nearby ones and seeking to far ones.
 Mat ExtractBackground(VideoCapture& video) {
 	const int frame_width = (int)video.get(CAP_PROP_FRAME_WIDTH);
 	const int frame_height = (int)video.get(CAP_PROP_FRAME_HEIGHT);
 	const int number_of_frames = (int)video.get(CAP_PROP_FRAME_COUNT);
-	vector<int> random_frames;
-
-	// Determine which random frames to use for background calculation
-	for (int i = 0; i < number_random_frames; i++) {
-		int random_frame = rand() % number_of_frames;
-		while (find(random_frames.begin(), random_frames.end(), random_frame) != random_frames.end()) {
-			random_frame = rand() % number_of_frames;
-		}
-		random_frames.push_back(random_frame);
-	}
+	vector<int> random_frames = PickSampleFrames(std::max(number_of_frames, 1), number_random_frames);
 
 	Mat extracted_background(frame_height, frame_width, CV_8UC3, Scalar::all(0));
+	Mat pixel_sums(frame_height, frame_width, CV_32SC3, Scalar::all(0));
 	Mat frame;
-	int curFrame = 0;
-	bool firstRandomFrame = true;
-	vector<vector<vector<int>>> backgroundPixels(frame_height);
-
-	// Go through each random frame and add its values to each pixel in extracted background
-	for (;;) {
-		video >> frame;
-		if (frame.empty()) {
+	int position = 0;
+	int collected = 0;
+
+	// Go to each random frame and add its values to each pixel's sum
+	for (int i = 0; i < (int)random_frames.size(); i++) {
+		if (!ReadFrameAt(video, position, random_frames[i], frame)) {
 			break;
 		}
-		if (find(random_frames.begin(), random_frames.end(), curFrame) != random_frames.end()) {
-			for (int row = 0; row < frame_height; row++) {
-				if (firstRandomFrame) {
-					vector<vector<int>> temp(frame_width);
-					backgroundPixels.at(row) = temp;
-				}
-				for (int col = 0; col < frame_width; col++) {
-					if (firstRandomFrame) {
-						vector<int> colorValues(3);
-						backgroundPixels.at(row).at(col) = colorValues;
-						backgroundPixels.at(row).at(col).at(2) = frame.at<Vec3b>(row, col)[2];
-						backgroundPixels.at(row).at(col).at(1) = frame.at<Vec3b>(row, col)[1];
-						backgroundPixels.at(row).at(col).at(0) = frame.at<Vec3b>(row, col)[0];
-					}
-					else {
-						backgroundPixels.at(row).at(col).at(2) += frame.at<Vec3b>(row, col)[2];
-						backgroundPixels.at(row).at(col).at(1) += frame.at<Vec3b>(row, col)[1];
-						backgroundPixels.at(row).at(col).at(0) += frame.at<Vec3b>(row, col)[0];
-					}
-				}
+		ParallelRows(frame_height, [&](int start_row, int end_row) {
+			for (int row = start_row; row < end_row; row++) {
+				const uchar* pixel = frame.ptr<uchar>(row);
+				int* sum = pixel_sums.ptr<int>(row);
+				for (int col = 0; col < frame_width * 3; col++) sum[col] += pixel[col];
 			}
-			firstRandomFrame = false;
-		}
-		curFrame++;
+		});
+		collected++;
+	}
+	if (collected == 0) {
+		video.set(CAP_PROP_POS_FRAMES, 0);
+		return extracted_background;
 	}
 
 	// Average every pixel in background to get final background from video
-	for (int row = 0; row < frame_height; row++) {
-		for (int col = 0; col < frame_width; col++) {
-			extracted_background.at<Vec3b>(row, col)[2] =
-				FixComputedColor(backgroundPixels.at(row).at(col).at(2) / number_random_frames);
-			extracted_background.at<Vec3b>(row, col)[1] =
-				FixComputedColor(backgroundPixels.at(row).at(col).at(1) / number_random_frames);
-			extracted_background.at<Vec3b>(row, col)[0] =
-				FixComputedColor(backgroundPixels.at(row).at(col).at(0) / number_random_frames);
+	ParallelRows(frame_height, [&](int start_row, int end_row) {
+		for (int row = start_row; row < end_row; row++) {
+			const int* sum = pixel_sums.ptr<int>(row);
+			uchar* pixel = extracted_background.ptr<uchar>(row);
+			for (int col = 0; col < frame_width * 3; col++) {
+				pixel[col] = (uchar)FixComputedColor(sum[col] / collected);
+			}
 		}
-	}
-	video.set(CAP_PROP_POS_MSEC, 0);
+	});
+	video.set(CAP_PROP_POS_FRAMES, 0);
 	return extracted_background;
 }
 
+// BackgroundRemover
+// Precondition: Parameters are properly formatted, passed in correctly and colored
+// Postcondition: output will be a binary Mat where the white spots are the differences between the
+//                2 passed in Mats. output is only reallocated when it does not already have the
+//                size of back.
+void BackgroundRemover(const Mat& front, const Mat& back, Mat& output) {
+	output.create(back.rows, back.cols, CV_8U);
+	ParallelRows(back.rows, [&](int start_row, int end_row) {
+		for (int row = start_row; row < end_row; row++) {
+			// A red threshold of 0 turns off the skin test the Updated version uses
+			BackgroundDiffRow(front.ptr<uchar>(row), back.ptr<uchar>(row), output.ptr<uchar>(row),
+				back.cols, background_remover_thresh, 0);
+		}
+	});
+}
+
 // BackgroundRemover
 // Precondition: Parameters are properly formatted, passed in correctly and colored
 // Postcondition: Will return a binary Matt where the white spots are the differences
 //                between the 2 passed in Mats.
 Mat BackgroundRemover(const Mat& front, const Mat& back) {
-	Mat output(back.rows, back.cols, CV_8U);
-	for (int row = 0; row < back.rows; row++) {
-		for (int col = 0; col < back.cols; col++) {
-			int front_color_b = front.at<Vec3b>(row, col)[0];
-			int front_color_g = front.at<Vec3b>(row, col)[1];
-			int front_color_r = front.at<Vec3b>(row, col)[2];
-			int back_color_b = back.at<Vec3b>(row, col)[0];
-			int back_color_g = back.at<Vec3b>(row, col)[1];
-			int back_color_r = back.at<Vec3b>(row, col)[2];
-			if (abs(front_color_b - back_color_b) < background_remover_thresh &&
-				abs(front_color_g - back_color_g) < background_remover_thresh &&
-				abs(front_color_r - back_color_r) < background_remover_thresh
-				) {	//Very similar
-				output.at<uchar>(row, col) = 0;
-			}
-			else {	//Not similar. Object here
-				output.at<uchar>(row, col) = 255;
-			}
-		}
-	}
+	Mat output;
+	BackgroundRemover(front, back, output);
 	return output;
 }
 
@@ -13,6 +13,7 @@
 #include <opencv2/videoio.hpp>
 #include <opencv2/video.hpp>
 #include "Hand.h"
+#include "TemplateIndex.h"
 using namespace cv;
 using namespace std;
 
@@ -25,11 +26,17 @@ using namespace std;
 int const min_hessian = 400;
 float const ratio_thresh = 0.7;
 string const template_path = "Templates\\hand";
+TemplateDescriptor const template_descriptor = SIFT_DESCRIPTOR;
+string const template_cache_files[3] = { "Templates\\hand_sift.bin", "Templates\\hand_orb.bin",
+	"Templates\\hand_brisk.bin" };	// One per TemplateDescriptor, in order
 int const similarity_threshold = 10;
 
 int FindNthBiggestContour(const vector<vector<Point>>& contours, Rect& box, const int n);
 int FindLocalMaximaMinima(const vector<Point>& points, const int middle);
 vector<Point> FindTopEdge(const Mat& object);
+bool BuildTemplateIndex(TemplateIndex& index, const string& template_path, const string& cache_file,
+	const TemplateDescriptor descriptor);
+TemplateMatch MatchTemplateIndex(const TemplateIndex& index, const Mat& object);
 
 // HowSimilarImagesAre
 // Preconditions: a valid hand template and front image containing a hand are passed in. This program should also
@@ -68,32 +75,21 @@ int HowSimilarImagesAre(const Mat& hand, const Mat& front) {
 }
 
 // TemplateMatchingWithObject
-// Preconditions: Numbered template files exist in the project directory and the function HowSimilarImagesAre
-// is fully functional and implemented.
+// Preconditions: Numbered template files exist in the project directory
 // Postconditions: Either returns an integer that matches a template with the hand position in the front image
-// passed in or returns -1, signifying that a hand was failed to detect.
+// passed in or returns -1, signifying that a hand was failed to detect. The templates are indexed the first
+// time it is called, after that each call is a single search of the index.
 int TemplateMatchingWithObject(const Mat& front) {
 	//Possible detect left vs right here first???
 
-	int most_similar_file = -1;
-	int highest_similar_value = -1;
+	static TemplateIndex index;
+	static const bool has_templates = BuildTemplateIndex(index, template_path,
+		template_cache_files[template_descriptor], template_descriptor);
+	if (!has_templates) return -1;
 
-	int i = 0;
-	while (true) {
-		string file_name = template_path + to_string(i) + ".jpg";
-		Mat hand = imread(file_name);
-
-		if (hand.empty()) break;
-		int current_simi = HowSimilarImagesAre(hand, front);
-		cout << i << " " << current_simi << endl;
-		if (current_simi > highest_similar_value) {
-			highest_similar_value = current_simi;
-			most_similar_file = i;
-		}
-		i++;
-	}
-	if (highest_similar_value >= similarity_threshold) {	//matches a template
-		return most_similar_file;
+	TemplateMatch match = MatchTemplateIndex(index, front);
+	if (match.score >= similarity_threshold) {	//matches a template
+		return match.index;
 	}
 	else {	//fails to detect hand
 		return -1;
@@ -0,0 +1,216 @@
+// Contains the template index for Hand Detection. The descriptors of the hand templates are worked out
+//  once, saved to a cache file that is remade when a template or the feature count changes, and stacked
+//  so every template is matched against a hand in one search. As in HowSimilarImagesAre each template
+//  descriptor looks for its nearest two hand descriptors, with FLANN for SIFT and by Hamming distance
+//  for ORB and BRISK.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/features2d.hpp>
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <climits>
+#include <cmath>
+#include <opencv2/core/types.hpp>
+#include <vector>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <opencv2/imgcodecs.hpp>
+#include "Hand.h"
+#include "TemplateIndex.h"
+using namespace cv;
+using namespace std;
+
+int const template_features = 400;
+float const template_ratio_thresh = 0.7f;
+int const template_cache_version = 3;
+char const template_cache_magic[4] = { 'H', 'T', 'I', 'X' };
+
+void HammingNearestTwo(const uchar* query, const Mat& train, int& nearest, int& best, int& second);
+
+// A template file's modification time and size, the cache is remade when either changes
+struct TemplateStamp {
+	int64 modified = 0;
+	int64 size = 0;
+};
+
+
+// CreateTemplateDetector
+// Precondition: None
+// Postcondition: Returns the detector and extractor for the kind of descriptor
+static Ptr<Feature2D> CreateTemplateDetector(const TemplateDescriptor descriptor) {
+	if (descriptor == ORB_DESCRIPTOR) return ORB::create(template_features);
+	if (descriptor == BRISK_DESCRIPTOR) return BRISK::create();
+	return SIFT::create(template_features);
+}
+
+// StampTemplate
+// Precondition: file_name is the path of a template
+// Postcondition: Returns true and fills stamp if the file exists, false if it does not
+static bool StampTemplate(const string& file_name, TemplateStamp& stamp) {
+	struct stat info;
+	if (stat(file_name.c_str(), &info) != 0) return false;
+	stamp.modified = (int64)info.st_mtime;
+	stamp.size = (int64)info.st_size;
+	return true;
+}
+
+// ReadTemplateCache
+// Precondition: stamps holds the stamp of each template, in order
+// Postcondition: Returns true and fills descriptors, one per template, if cache_file exists and was
+//                made from templates with the same stamps, the same kind of descriptor and the same
+//                template_features. Returns false otherwise.
+static bool ReadTemplateCache(const string& cache_file, const TemplateDescriptor descriptor,
+	const vector<TemplateStamp>& stamps, vector<Mat>& descriptors) {
+	ifstream in(cache_file, ios::binary);
+	if (!in) return false;
+
+	char magic[4];
+	int version = 0, kind = 0, features = 0, count = 0;
+	in.read(magic, sizeof(magic));
+	in.read((char*)&version, sizeof(version));
+	in.read((char*)&kind, sizeof(kind));
+	in.read((char*)&features, sizeof(features));
+	in.read((char*)&count, sizeof(count));
+	if (!in || memcmp(magic, template_cache_magic, sizeof(magic)) != 0 || version != template_cache_version ||
+		kind != (int)descriptor || features != template_features || count != (int)stamps.size()) return false;
+
+	descriptors.assign(count, Mat());
+	for (int i = 0; i < count; i++) {
+		TemplateStamp stamp;
+		int rows = 0, cols = 0, type = 0;
+		in.read((char*)&stamp.modified, sizeof(stamp.modified));
+		in.read((char*)&stamp.size, sizeof(stamp.size));
+		in.read((char*)&rows, sizeof(rows));
+		in.read((char*)&cols, sizeof(cols));
+		in.read((char*)&type, sizeof(type));
+		if (!in || stamp.modified != stamps[i].modified || stamp.size != stamps[i].size ||
+			rows < 0 || cols < 0) return false;
+		if (rows == 0) continue;
+
+		descriptors[i].create(rows, cols, type);
+		in.read((char*)descriptors[i].data, descriptors[i].total() * descriptors[i].elemSize());
+		if (!in) return false;
+	}
+	return true;
+}
+
+// WriteTemplateCache
+// Precondition: stamps and descriptors hold one entry per template, in order
+// Postcondition: cache_file holds the descriptors and the stamps they were made from. A cache that can
+//                not be written is left out, the index still works without it.
+static void WriteTemplateCache(const string& cache_file, const TemplateDescriptor descriptor,
+	const vector<TemplateStamp>& stamps, const vector<Mat>& descriptors) {
+	ofstream out(cache_file, ios::binary | ios::trunc);
+	if (!out) return;
+
+	int kind = (int)descriptor;
+	int count = (int)stamps.size();
+	out.write(template_cache_magic, sizeof(template_cache_magic));
+	out.write((const char*)&template_cache_version, sizeof(template_cache_version));
+	out.write((const char*)&kind, sizeof(kind));
+	out.write((const char*)&template_features, sizeof(template_features));
+	out.write((const char*)&count, sizeof(count));
+	for (int i = 0; i < count; i++) {
+		Mat values = descriptors[i].isContinuous() ? descriptors[i] : descriptors[i].clone();
+		int rows = values.rows, cols = values.cols, type = values.type();
+		out.write((const char*)&stamps[i].modified, sizeof(stamps[i].modified));
+		out.write((const char*)&stamps[i].size, sizeof(stamps[i].size));
+		out.write((const char*)&rows, sizeof(rows));
+		out.write((const char*)&cols, sizeof(cols));
+		out.write((const char*)&type, sizeof(type));
+		if (rows > 0) out.write((const char*)values.data, values.total() * values.elemSize());
+	}
+}
+
+// BuildTemplateIndex
+// Precondition: The templates are numbered from 0 as template_path + number + ".jpg"
+// Postcondition: index holds every template's descriptors of the given kind stacked in one matrix,
+//                and a FLANN matcher for SIFT. They come from cache_file when none of the templates
+//                changed since it was written, otherwise they are worked out again and the cache is
+//                rewritten. An empty cache_file skips the cache. Returns false if there are no
+//                templates.
+bool BuildTemplateIndex(TemplateIndex& index, const string& template_path, const string& cache_file,
+	const TemplateDescriptor descriptor) {
+	vector<TemplateStamp> stamps;
+	TemplateStamp stamp;
+	while (StampTemplate(template_path + to_string(stamps.size()) + ".jpg", stamp)) {
+		stamps.push_back(stamp);
+	}
+
+	index.descriptor = descriptor;
+	index.detector = CreateTemplateDetector(descriptor);
+	vector<Mat> descriptors;
+	if (!ReadTemplateCache(cache_file, descriptor, stamps, descriptors)) {
+		descriptors.assign(stamps.size(), Mat());
+		for (int i = 0; i < (int)stamps.size(); i++) {
+			Mat hand = imread(template_path + to_string(i) + ".jpg");
+			if (hand.empty()) continue;
+			vector<KeyPoint> keypoints;
+			index.detector->detectAndCompute(hand, noArray(), keypoints, descriptors[i]);
+		}
+		WriteTemplateCache(cache_file, descriptor, stamps, descriptors);
+	}
+
+	Mat all_descriptors;
+	index.owner.clear();
+	for (int i = 0; i < (int)descriptors.size(); i++) {
+		if (descriptors[i].empty()) continue;
+		all_descriptors.push_back(descriptors[i]);
+		index.owner.insert(index.owner.end(), descriptors[i].rows, i);
+	}
+	index.templates = (int)stamps.size();
+	if (all_descriptors.empty()) return false;
+
+	index.descriptors = all_descriptors;
+	if (descriptor == SIFT_DESCRIPTOR) index.matcher = DescriptorMatcher::create(DescriptorMatcher::FLANNBASED);
+	return true;
+}
+
+// MatchTemplateIndex
+// Precondition: index was built by BuildTemplateIndex, object is an image of a possible hand
+// Postcondition: Returns the template with the most descriptors matching the object and how many did,
+//                the same score HowSimilarImagesAre gives each template. A template descriptor matches
+//                when its nearest object descriptor is clearly nearer than the next one. All templates
+//                are searched in one knnMatch over the object's descriptors. Index is -1 if nothing
+//                matched.
+TemplateMatch MatchTemplateIndex(const TemplateIndex& index, const Mat& object) {
+	TemplateMatch best;
+	bool const binary = (index.descriptor != SIFT_DESCRIPTOR);
+	if (index.descriptors.empty() || (!binary && index.matcher.empty()) || object.empty()) return best;
+
+	vector<KeyPoint> keypoints;
+	Mat descriptors;
+	index.detector->detectAndCompute(object, noArray(), keypoints, descriptors);
+	if (descriptors.rows == 0) return best;
+
+	vector<int> scores(index.templates, 0);
+	if (binary) {
+		for (int i = 0; i < index.descriptors.rows; i++) {
+			int nearest, closest, second;
+			HammingNearestTwo(index.descriptors.ptr<uchar>(i), descriptors, nearest, closest, second);
+			if (second != INT_MAX && closest < template_ratio_thresh * second) {
+				scores[index.owner[i]]++;
+			}
+		}
+	}
+	else {
+		vector<vector<DMatch>> matches;
+		index.matcher->knnMatch(index.descriptors, descriptors, matches, 2);
+		for (size_t i = 0; i < matches.size(); i++) {
+			if (matches[i].size() < 2) continue;
+			if (matches[i][0].distance < template_ratio_thresh * matches[i][1].distance) {
+				scores[index.owner[matches[i][0].queryIdx]]++;
+			}
+		}
+	}
+	for (int i = 0; i < index.templates; i++) {
+		if (scores[i] > best.score) {
+			best.score = scores[i];
+			best.index = i;
+		}
+	}
+	return best;
+}
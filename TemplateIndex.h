@@ -0,0 +1,29 @@
+// Contains the TemplateIndex struct for Hand Detection. Struct holds the descriptors of every hand
+//  template stacked in one matrix, so every template can be matched against a hand at once. Also
+//  contains the kinds of descriptors the index can be built from.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#pragma once
+#include "Hand.h"
+
+// Descriptors the template index can use
+enum TemplateDescriptor {
+	SIFT_DESCRIPTOR,	// Float descriptors searched with FLANN, the most accurate
+	ORB_DESCRIPTOR,		// Binary descriptors compared by Hamming distance, the fastest
+	BRISK_DESCRIPTOR	// Binary descriptors compared by Hamming distance
+};
+
+struct TemplateIndex {
+	TemplateDescriptor descriptor = SIFT_DESCRIPTOR;
+	Ptr<Feature2D> detector;
+	Ptr<DescriptorMatcher> matcher;		// FLANN matcher the hand's descriptors are searched with, SIFT only
+	Mat descriptors;					// Descriptors of every template one per row
+	vector<int> owner;					// Template number of each descriptor in the index, in order
+	int templates = 0;
+};
+
+// The template a hand matched best and how many of its descriptors matched
+struct TemplateMatch {
+	int index = -1;
+	int score = 0;
+};
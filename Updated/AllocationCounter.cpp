@@ -0,0 +1,137 @@
+// Contains the replaced operator new and delete behind the heap allocation counter for Hand Detection.
+//  Compiles to nothing unless HAND_COUNT_ALLOCATIONS is defined, which debug builds do by themselves.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#include "AllocationCounter.h"
+
+#ifdef HAND_COUNT_ALLOCATIONS
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <stdio.h>
+#include <string.h>
+
+static atomic<int64> heap_allocations(0);
+thread_local StageAllocations stage_allocations[stage_allocation_slots];
+
+// Allocates size bytes and counts it, throwing bad_alloc like the operator new it replaces
+static void* CountedAllocate(size_t size) {
+	heap_allocations.fetch_add(1, memory_order_relaxed);
+	void* memory = malloc(size == 0 ? 1 : size);
+	if (memory == nullptr) throw bad_alloc();
+	return memory;
+}
+
+void* operator new(size_t size) {
+	return CountedAllocate(size);
+}
+
+void* operator new[](size_t size) {
+	return CountedAllocate(size);
+}
+
+void operator delete(void* memory) noexcept {
+	free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+	free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+	free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept {
+	free(memory);
+}
+
+// HeapAllocations
+// Precondition: None
+// Postcondition: Returns how many times operator new has run in the program so far, on any thread
+int64 HeapAllocations() {
+	return heap_allocations.load(memory_order_relaxed);
+}
+
+// RecordFrameAllocations
+// Precondition: count is how many heap allocations one frame of the loop made
+// Postcondition: The frame is added to the analyzed or skipped totals of allocations
+void RecordFrameAllocations(FrameAllocations& allocations, bool const analyzed, int64 const count) {
+	allocations.frames[analyzed]++;
+	allocations.total[analyzed] += count;
+	allocations.most[analyzed] = max(allocations.most[analyzed], count);
+}
+
+// PrintFrameAllocations
+// Precondition: Each count recorded in allocations leaves out the frame's decode and encode
+// Postcondition: The mean and largest allocations per frame are printed to the console, zero once
+//                nothing in the loop but the codecs allocates
+void PrintFrameAllocations(const FrameAllocations& allocations) {
+	const char* const kinds[2] = {"skipped", "analyzed"};
+	for (int analyzed = 1; analyzed >= 0; analyzed--) {
+		int const frames = allocations.frames[analyzed];
+		if (frames == 0) continue;
+		printf("Heap allocations per %s frame after warm-up, without decode and encode: mean %.2f, most %lld "
+			"over %d frames\n", kinds[analyzed], (double)allocations.total[analyzed] / frames,
+			(long long)allocations.most[analyzed], frames);
+	}
+}
+
+// Returns the calling thread's entry for stage, taking a free one when add is set, or nullptr
+static StageAllocations* FindStageAllocations(const char* stage, bool const add) {
+	for (int i = 0; i < stage_allocation_slots; i++) {
+		StageAllocations& entry = stage_allocations[i];
+		if (entry.stage == nullptr) {
+			if (!add) return nullptr;
+			entry.stage = stage;
+			return &entry;
+		}
+		if (entry.stage == stage || strcmp(entry.stage, stage) == 0) return &entry;
+	}
+	return nullptr;
+}
+
+// RecordStageAllocations
+// Precondition: stage is a string literal, count is how many heap allocations one run of it made
+// Postcondition: The run is added to the calling thread's totals for stage
+void RecordStageAllocations(const char* stage, int64 const count) {
+	StageAllocations* const entry = FindStageAllocations(stage, true);
+	if (entry == nullptr) return;
+	entry->runs++;
+	entry->total += count;
+	entry->most = max(entry->most, count);
+}
+
+// StageAllocationTotal
+// Precondition: None
+// Postcondition: Returns the heap allocations the calling thread's runs of stage made since the last
+//                reset, 0 if it has not run
+int64 StageAllocationTotal(const char* stage) {
+	const StageAllocations* const entry = FindStageAllocations(stage, false);
+	return entry == nullptr ? 0 : entry->total;
+}
+
+// ResetStageAllocations
+// Precondition: No stage is running on the calling thread
+// Postcondition: The calling thread's stage totals start again from zero, keeping their names
+void ResetStageAllocations() {
+	for (int i = 0; i < stage_allocation_slots; i++) {
+		stage_allocations[i].runs = 0;
+		stage_allocations[i].total = 0;
+		stage_allocations[i].most = 0;
+	}
+}
+
+// PrintStageAllocations
+// Precondition: None
+// Postcondition: The mean and largest allocations per run of every stage the calling thread ran
+//                since the last reset are printed to the console
+void PrintStageAllocations() {
+	for (int i = 0; i < stage_allocation_slots && stage_allocations[i].stage != nullptr; i++) {
+		const StageAllocations& entry = stage_allocations[i];
+		if (entry.runs == 0) continue;
+		printf("Heap allocations per %s after warm-up: mean %.2f, most %lld over %d runs\n", entry.stage,
+			(double)entry.total / entry.runs, (long long)entry.most, entry.runs);
+	}
+}
+#endif
@@ -0,0 +1,62 @@
+// Contains the heap allocation counter for Hand Detection. In debug builds, or whenever
+//  HAND_COUNT_ALLOCATIONS is defined, every operator new in the program is counted, which includes
+//  OpenCV's own where the platform resolves it to the program's operator new, as it does on Linux.
+//  A Mat's buffer is counted through the header OpenCV makes for it with new. Every STAGE_TIMER block
+//  also counts its own allocations under its stage name, so what is left can be put down to a stage.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#pragma once
+#include "Hand.h"
+
+#if !defined(NDEBUG) && !defined(HAND_COUNT_ALLOCATIONS)
+#define HAND_COUNT_ALLOCATIONS 1
+#endif
+
+#ifdef HAND_COUNT_ALLOCATIONS
+int const steady_state_analyses = 30;	// Analyzed frames after warm-up before frames are counted
+
+// Heap allocations of the frames in the steady state, split by whether the frame was analyzed
+struct FrameAllocations {
+	int frames[2] = {0, 0};			// Indexed by whether the frame was analyzed
+	int64 total[2] = {0, 0};
+	int64 most[2] = {0, 0};
+};
+
+int const stage_allocation_slots = 32;	// Stage names counted per thread, more are not counted
+
+// Heap allocations of every run of one stage on one thread
+struct StageAllocations {
+	const char* stage = nullptr;
+	int runs = 0;
+	int64 total = 0;
+	int64 most = 0;
+};
+
+int64 HeapAllocations();
+void RecordFrameAllocations(FrameAllocations& allocations, bool const analyzed, int64 const count);
+void PrintFrameAllocations(const FrameAllocations& allocations);
+void RecordStageAllocations(const char* stage, int64 const count);
+int64 StageAllocationTotal(const char* stage);
+void ResetStageAllocations();
+void PrintStageAllocations();
+
+// Counts the heap allocations made between its construction and destruction towards stage
+class StageAllocationScope {
+public:
+	explicit StageAllocationScope(const char* stage) : stage(stage), start(HeapAllocations()) {}
+
+	~StageAllocationScope() {
+		RecordStageAllocations(stage, HeapAllocations() - start);
+	}
+
+private:
+	const char* const stage;
+	int64 const start;
+};
+
+#define STAGE_ALLOCATIONS_NAME(line) stage_allocations_##line
+#define STAGE_ALLOCATIONS_AT(line) STAGE_ALLOCATIONS_NAME(line)
+#define STAGE_ALLOCATIONS(stage) StageAllocationScope STAGE_ALLOCATIONS_AT(__LINE__)(stage)
+#else
+#define STAGE_ALLOCATIONS(stage)
+#endif
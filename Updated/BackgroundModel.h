@@ -0,0 +1,19 @@
+// Contains the BackgroundModel struct for Hand Detection. Struct holds the running average of the
+//  background, which is updated with each processed frame instead of being extracted up front. Also
+//  contains the estimators ExtractBackground can use when the background is extracted up front.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#pragma once
+#include "Hand.h"
+
+struct BackgroundModel {
+	Mat average;		// Running average of each channel as CV_32FC3
+	Mat background;		// average rounded back to a colored image
+	int frames_seen = 0;
+};
+
+// Ways ExtractBackground can combine its sampled frames into one background
+enum BackgroundEstimator {
+	MEAN_ESTIMATOR,		// Average of the samples, the hand leaves a ghost wherever it stayed
+	MEDIAN_ESTIMATOR	// Median of the samples, ignores the hand unless it covers a pixel in most of them
+};
@@ -0,0 +1,153 @@
+// Contains the thread scaling benchmark for the row band loops of Hand Detection. Each per pixel loop
+//  is timed at 720p, 1080p and 4K with 1 thread up to one per core, and the time and speedup over a
+//  single thread are printed. The threaded pipeline is then run over the whole bundled video with the
+//  same worker counts. Build together with ../ImageOperations.cpp, ../BackgroundKernels.cpp,
+//  ../RunMask.cpp, ../Contours.cpp, ../ObjectRecognition.cpp, ../PrintInfo.cpp and ../Pipeline.cpp.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/videoio.hpp>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <stdio.h>
+#include "../Hand.h"
+#include "../BackgroundModel.h"
+#include "../Parallel.h"
+using namespace cv;
+using namespace std;
+
+string const video_name_path = "../hand.mp4";
+int const bench_repeats = 15;
+int const bench_frame = 60;
+string const pipeline_bench_output = "pipeline_bench.avi";
+int const pipeline_bench_skip = 1;	// Every frame is analyzed, so the workers carry the load
+
+void ModifyContrast(Mat& pic, double const contrast);
+void ModifySaturation(Mat& image, int const saturate);
+void ApplyBrightnessSaturation(Mat& image, int const brightness, int const saturate);
+void BackgroundRemover(const Mat& front, const Mat& back, Mat& output);
+void UpdateBackgroundModel(BackgroundModel& model, const Mat& frame, const Mat& foreground);
+Mat ExtractBackground(VideoCapture& video, BackgroundEstimator const estimator);
+void PrepareImage(Mat& image, Scalar& contrast_mean, int const scale);
+int RunPipeline(VideoCapture& video, const Mat& background, VideoWriter& output, int const skip,
+	int const threads, const bool components);
+
+
+// LoadBenchFrame
+// Precondition: size is the resolution wanted and index is a frame of the video
+// Postcondition: Returns a frame of the bundled video scaled to size, or random noise if the video
+//                can not be read
+Mat LoadBenchFrame(const Size& size, int const index) {
+	VideoCapture video(video_name_path);
+	Mat frame;
+	if (video.isOpened()) {
+		video.set(CAP_PROP_POS_FRAMES, index);
+		video >> frame;
+	}
+	if (frame.empty()) {
+		frame.create(size, CV_8UC3);
+		randu(frame, Scalar::all(0), Scalar::all(255));
+		return frame;
+	}
+	resize(frame, frame, size, 0, 0, INTER_LINEAR);
+	return frame;
+}
+
+// TimeStage
+// Precondition: input is the image the stage starts from
+// Postcondition: Returns the median time in milliseconds of running stage on a fresh copy of input.
+//                Copying the input is not part of the time.
+double TimeStage(const Mat& input, const function<void(Mat&)>& stage) {
+	vector<double> times;
+	Mat work;
+	for (int i = 0; i < bench_repeats; i++) {
+		input.copyTo(work);
+		int64 start = getTickCount();
+		stage(work);
+		times.push_back((getTickCount() - start) * 1000.0 / getTickFrequency());
+	}
+	sort(times.begin(), times.end());
+	return times[times.size() / 2];
+}
+
+// PrintPipelineScaling
+// Precondition: thread_counts starts with 1
+// Postcondition: The bundled video is run through the threaded pipeline once per worker count, and the
+//                frames per second and speedup over one worker are printed. The per pixel loops run
+//                single threaded, so only the pipeline's own workers scale.
+void PrintPipelineScaling(const vector<int>& thread_counts) {
+	VideoCapture video(video_name_path);
+	if (!video.isOpened()) {
+		printf("\nPipeline skipped, %s can not be read\n", video_name_path.c_str());
+		return;
+	}
+	Size const frame_size((int)video.get(CAP_PROP_FRAME_WIDTH), (int)video.get(CAP_PROP_FRAME_HEIGHT));
+	Mat background = ExtractBackground(video, MEDIAN_ESTIMATOR);
+	Scalar background_mean = Scalar::all(-1);
+	PrepareImage(background, background_mean, 1);
+	SetWorkerThreads(1);
+
+	printf("\n%-8s %8s %8s %10s %8s\n", "pipeline", "workers", "frames", "fps", "speedup");
+	double single = 0;
+	for (int threads : thread_counts) {
+		video.set(CAP_PROP_POS_FRAMES, 0);
+		VideoWriter output(pipeline_bench_output, VideoWriter::fourcc('M', 'J', 'P', 'G'), 30, frame_size);
+		int64 const start = getTickCount();
+		int const frames = RunPipeline(video, background, output, pipeline_bench_skip, threads, true);
+		double const fps = frames / ((getTickCount() - start) / getTickFrequency());
+		if (threads == 1) single = fps;
+		printf("%-8s %8d %8d %10.1f %7.2fx\n", "", threads, frames, fps, fps / single);
+	}
+}
+
+// Main Method - Benchmark
+// Precondition: hand.mp4 is one directory up, otherwise random frames are used
+// Postcondition: A table of stage times and speedups is printed for each resolution and thread count,
+//                followed by the pipeline's frames per second for each worker count
+int main() {
+	vector<Size> sizes = { Size(1280, 720), Size(1920, 1080), Size(3840, 2160) };
+	vector<string> size_names = { "720p", "1080p", "4K" };
+	vector<int> thread_counts;
+	for (int threads = 1; threads < getNumberOfCPUs(); threads *= 2) {
+		thread_counts.push_back(threads);
+	}
+	thread_counts.push_back(getNumberOfCPUs());
+
+	vector<string> stage_names = { "ModifyContrast", "ModifySaturation", "ApplyBrightnessSaturation",
+		"BackgroundRemover", "UpdateBackgroundModel" };
+	printf("%-6s %-26s %8s %10s %8s\n", "size", "stage", "threads", "ms", "speedup");
+
+	for (int s = 0; s < (int)sizes.size(); s++) {
+		Mat frame = LoadBenchFrame(sizes[s], bench_frame);
+		Mat background = LoadBenchFrame(sizes[s], 0);
+		Mat mask;
+		BackgroundModel model;
+		for (int i = 0; i < 31; i++) {
+			UpdateBackgroundModel(model, background, Mat());
+		}
+
+		vector<function<void(Mat&)>> stages = {
+			[](Mat& image) { ModifyContrast(image, 1.1); },
+			[](Mat& image) { ModifySaturation(image, 28); },
+			[](Mat& image) { ApplyBrightnessSaturation(image, 40, 28); },
+			[&](Mat& image) { BackgroundRemover(image, background, mask); },
+			[&](Mat& image) { UpdateBackgroundModel(model, image, mask); }
+		};
+
+		for (int stage = 0; stage < (int)stages.size(); stage++) {
+			double single = 0;
+			for (int threads : thread_counts) {
+				SetWorkerThreads(threads);
+				double ms = TimeStage(frame, stages[stage]);
+				if (threads == 1) single = ms;
+				printf("%-6s %-26s %8d %10.3f %7.2fx\n", size_names[s].c_str(), stage_names[stage].c_str(),
+					threads, ms, single / ms);
+			}
+		}
+	}
+	PrintPipelineScaling(thread_counts);
+	return 0;
+}
@@ -0,0 +1,504 @@
+// Contains the per stage benchmark of Hand Detection. Each stage of the detection is timed on its own,
+//  on frames of the bundled videos and the WIN_*.jpg stills at several resolutions. The median, 95th
+//  percentile and bytes per second of every stage are written as JSON, and can be compared against a
+//  saved run. PrepareImage is also timed with each smoothing backend, next to how well its mask agrees
+//  with the OpenCV blurs. Every video is also run through the detection frame by frame, to compare how
+//  often fixed skips and the adaptive scheduler agree with analyzing every frame against how many frames
+//  they analyze. Build together with ../ImageOperations.cpp, ../BackgroundKernels.cpp, ../Contours.cpp,
+//  ../RunMask.cpp, ../ObjectRecognition.cpp, ../PrintInfo.cpp and ../FrameScheduler.cpp, with
+//  HAND_EMBED_HUD_ICONS defined for the HUD stage.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/videoio.hpp>
+#include <iostream>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <functional>
+#include <stdio.h>
+#include <stdlib.h>
+#include <climits>
+#include <cmath>
+#include "../Hand.h"
+#include "../BackgroundModel.h"
+#include "../Parallel.h"
+#include "../Smoothing.h"
+#include "../RunMask.h"
+#include "../FrameScheduler.h"
+using namespace cv;
+using namespace std;
+
+vector<string> const video_paths = { "../hand.mp4", "../../india.mp4" };
+string const still_pattern = "../../WIN_*.jpg";
+string const encode_path = "stage_benchmark_encode.avi";
+vector<Size> const bench_sizes = { Size(1280, 720), Size(1920, 1080) };
+int const bench_repeats = 15;
+int const background_repeats = 3;
+int const bench_frame = 60;
+double const default_regression = 0.10;		// Slower than the baseline by more than this is reported
+vector<int> const schedule_skips = { 1, 2, 3, 4, 6, 8 };
+double const schedule_location_tolerance = 0.05;	// Share of the frame width a shown hand may be off by
+string const smoothing_names[SMOOTHING_BACKENDS] = { "opencv", "histogram median", "box gaussian", "fast",
+	"downscaled" };
+
+// A picture the stages are timed on, with the background it is compared against
+struct BenchInput {
+	string name;
+	Mat frame;
+	Mat background;
+};
+
+// The timing of one stage on one input
+struct StageResult {
+	string stage;
+	string input;
+	string size;
+	double median_ms = 0;
+	double p95_ms = 0;
+	double mb_per_s = 0;
+};
+
+// How the mask from one smoothing backend agrees with the OpenCV one on one input
+struct SmoothingResult {
+	string backend;
+	string input;
+	string size;
+	double agreement = 0;	// Share of mask pixels that are the same
+	double overlap = 0;		// Intersection over union of the foregrounds
+};
+
+// How often the hand shown under one schedule matches analyzing every frame of one video
+struct ScheduleResult {
+	string schedule;
+	string input;
+	int frames = 0;
+	int analyzed = 0;
+	double agreement = 0;	// Share of frames showing the same hand type, close to the same place
+	double analyze_s = 0;	// Time spent in the analyzed frames' detection
+};
+
+void PrepareImage(Mat& image);
+void PrepareImage(Mat& image, Scalar& contrast_mean, int const scale, bool const integer_math,
+	SmoothingBackend smoothing);
+Vec2d SmoothingAgreement(const Mat& frame, const Mat& background, SmoothingBackend const smoothing);
+void ModifyContrast(Mat& pic, double const contrast);
+void ModifySaturation(Mat& image, int const saturate);
+void BackgroundRemover(const Mat& front, const Mat& back, Mat& output);
+void BackgroundRemover(const Mat& front, const Mat& back, RunMask& output);
+Mat ExtractBackground(VideoCapture& video);
+vector<vector<Point>> FindImageContours(const Mat& object);
+vector<ContourCandidate> SelectHandCandidates(const vector<vector<Point>>& contours, const int area);
+void ExtractHandCandidates(const Mat& mask, const int area, vector<vector<Point>>& contours,
+	vector<ContourCandidate>& candidates, DetectorScratch& scratch);
+void ExtractHandCandidates(const RunMask& mask, const int area, vector<vector<Point>>& contours,
+	vector<ContourCandidate>& candidates, DetectorScratch& scratch);
+Hand SearchForHand(const vector<vector<Point>>& contours, const vector<ContourCandidate>& candidates,
+	Rect& box, DetectorScratch& scratch);
+vector<Point> FindTopEdge(const Mat& object);
+vector<Point> FindTopEdge(const vector<Point>& contour, const Rect& box);
+int FindLocalMaximaMinima(const vector<Point>& points, const int middle);
+void DrawHandInfo(Mat& frame, const Hand& hand, const int shape_type, const Rect& box);
+bool LoadHudAssets();
+bool ShouldAnalyze(FrameScheduler& scheduler, const Mat& frame);
+void RecordAnalysis(FrameScheduler& scheduler, const double milliseconds);
+
+
+// SizeName
+// Precondition: None
+// Postcondition: Returns size written as width x height
+string SizeName(const Size& size) {
+	return to_string(size.width) + "x" + to_string(size.height);
+}
+
+// LoadBenchInputs
+// Precondition: None
+// Postcondition: Returns a frame of each bundled video, compared against its first frame, and each
+//                still, compared against a plain image of its mean color. Each is given at its own size
+//                and at every one of bench_sizes. Files that can not be read are left out.
+vector<BenchInput> LoadBenchInputs() {
+	vector<BenchInput> sources;
+	for (size_t v = 0; v < video_paths.size(); v++) {
+		VideoCapture video(video_paths[v]);
+		BenchInput source;
+		source.name = video_paths[v];
+		video >> source.background;
+		video.set(CAP_PROP_POS_FRAMES, bench_frame);
+		video >> source.frame;
+		if (!source.frame.empty() && !source.background.empty()) sources.push_back(source);
+	}
+	vector<string> stills;
+	glob(still_pattern, stills, false);
+	for (size_t i = 0; i < stills.size(); i++) {
+		BenchInput source;
+		source.name = stills[i];
+		source.frame = imread(stills[i]);
+		if (source.frame.empty()) continue;
+		source.background = Mat(source.frame.size(), CV_8UC3, mean(source.frame));
+		sources.push_back(source);
+	}
+
+	vector<BenchInput> inputs;
+	for (size_t i = 0; i < sources.size(); i++) {
+		inputs.push_back(sources[i]);
+		for (size_t s = 0; s < bench_sizes.size(); s++) {
+			if (bench_sizes[s] == sources[i].frame.size()) continue;
+			BenchInput scaled;
+			scaled.name = sources[i].name;
+			resize(sources[i].frame, scaled.frame, bench_sizes[s], 0, 0, INTER_AREA);
+			resize(sources[i].background, scaled.background, bench_sizes[s], 0, 0, INTER_AREA);
+			inputs.push_back(scaled);
+		}
+	}
+	return inputs;
+}
+
+// TimeStage
+// Precondition: input is the image the stage starts from, bytes is how much of it the stage reads
+// Postcondition: Returns the median and 95th percentile in milliseconds of running stage repeats times on
+//                a fresh copy of input, and the bytes per second at the median. Copying is not timed.
+StageResult TimeStage(const string& stage_name, const BenchInput& input, const Mat& start, double const bytes,
+	int const repeats, const function<void(Mat&)>& stage) {
+	vector<double> times;
+	Mat work;
+	for (int i = 0; i < repeats; i++) {
+		start.copyTo(work);
+		int64 begin = getTickCount();
+		stage(work);
+		times.push_back((getTickCount() - begin) * 1000.0 / getTickFrequency());
+	}
+	sort(times.begin(), times.end());
+
+	StageResult result;
+	result.stage = stage_name;
+	result.input = input.name;
+	result.size = SizeName(input.frame.size());
+	result.median_ms = times[times.size() / 2];
+	result.p95_ms = times[min(times.size() - 1, (size_t)ceil(times.size() * 0.95) - 1)];
+	result.mb_per_s = result.median_ms > 0 ? bytes / (result.median_ms * 1000.0) : 0;
+	return result;
+}
+
+// BenchInputStages
+// Precondition: input holds a frame and its background
+// Postcondition: Every stage that can run on input is timed and added to results, and the agreement of
+//                every smoothing backend is added to smoothing. The contour stages use the hand
+//                candidate the detection would try first, and are left out if there is none.
+void BenchInputStages(const BenchInput& input, const bool hud_loaded, vector<StageResult>& results,
+	vector<SmoothingResult>& smoothing) {
+	double const frame_bytes = (double)input.frame.total() * input.frame.elemSize();
+	Mat prepared = input.frame.clone();
+	Mat prepared_background = input.background.clone();
+	PrepareImage(prepared);
+	PrepareImage(prepared_background);
+	Mat mask;
+	BackgroundRemover(prepared, prepared_background, mask);
+	double const mask_bytes = (double)mask.total();
+
+	results.push_back(TimeStage("PrepareImage", input, input.frame, frame_bytes, bench_repeats,
+		[](Mat& image) { PrepareImage(image); }));
+	for (int backend = 0; backend < SMOOTHING_BACKENDS; backend++) {
+		SmoothingBackend const chosen = SmoothingBackend(backend);
+		results.push_back(TimeStage("PrepareImage(" + smoothing_names[backend] + ")", input, input.frame,
+			frame_bytes, bench_repeats, [&](Mat& image) {
+				Scalar contrast_mean = Scalar::all(-1);
+				PrepareImage(image, contrast_mean, 1, true, chosen);
+			}));
+		Vec2d const agreement = SmoothingAgreement(input.frame, input.background, chosen);
+		SmoothingResult result;
+		result.backend = smoothing_names[backend];
+		result.input = input.name;
+		result.size = SizeName(input.frame.size());
+		result.agreement = agreement[0];
+		result.overlap = agreement[1];
+		smoothing.push_back(result);
+	}
+	results.push_back(TimeStage("ModifyContrast", input, input.frame, frame_bytes, bench_repeats,
+		[](Mat& image) { ModifyContrast(image, 1.1); }));
+	results.push_back(TimeStage("ModifySaturation", input, input.frame, frame_bytes, bench_repeats,
+		[](Mat& image) { ModifySaturation(image, 28); }));
+	Mat output;
+	results.push_back(TimeStage("BackgroundRemover", input, prepared, frame_bytes * 2, bench_repeats,
+		[&](Mat& image) { BackgroundRemover(image, prepared_background, output); }));
+	RunMask runs;
+	results.push_back(TimeStage("BackgroundRemover(runs)", input, prepared, frame_bytes * 2, bench_repeats,
+		[&](Mat& image) { BackgroundRemover(image, prepared_background, runs); }));
+	double const run_bytes = (double)(runs.runs.size() * sizeof(MaskRun) + runs.row_start.size() * sizeof(int));
+
+	vector<vector<Point>> contours;
+	vector<ContourCandidate> candidates;
+	results.push_back(TimeStage("FindImageContours+SelectHandCandidates", input, mask, mask_bytes, bench_repeats,
+		[&](Mat& object) {
+			contours = FindImageContours(object);
+			candidates = SelectHandCandidates(contours, object.rows * object.cols);
+		}));
+	DetectorScratch scratch;
+	results.push_back(TimeStage("ExtractHandCandidates", input, mask, mask_bytes, bench_repeats,
+		[&](Mat& object) {
+			ExtractHandCandidates(object, object.rows * object.cols, contours, candidates, scratch);
+		}));
+	results.push_back(TimeStage("ExtractHandCandidates(runs)", input, mask, run_bytes, bench_repeats,
+		[&](Mat&) { ExtractHandCandidates(runs, mask.rows * mask.cols, contours, candidates, scratch); }));
+	Hand hand;
+	Rect box;
+	results.push_back(TimeStage("SearchForHand", input, mask, mask_bytes, bench_repeats,
+		[&](Mat&) { hand = SearchForHand(contours, candidates, box, scratch); }));
+
+	if (!candidates.empty()) {
+		const ContourCandidate& first = candidates[0];
+		Mat object = Mat::zeros(first.box.size(), CV_8U);
+		drawContours(object, contours, first.index, Scalar(255), FILLED, LINE_8, noArray(), INT_MAX,
+			Point(-first.box.x, -first.box.y));
+		double const object_bytes = (double)object.total();
+		vector<Point> points;
+		results.push_back(TimeStage("FindTopEdge(mask)", input, object, object_bytes, bench_repeats,
+			[&](Mat& image) { points = FindTopEdge(image); }));
+		results.push_back(TimeStage("FindTopEdge(contour)", input, object, object_bytes, bench_repeats,
+			[&](Mat&) { points = FindTopEdge(contours[first.index], first.box); }));
+		if (points.size() >= 3) {
+			results.push_back(TimeStage("FindLocalMaximaMinima", input, object, points.size() * sizeof(Point),
+				bench_repeats, [&](Mat&) { FindLocalMaximaMinima(points, first.box.height / 2); }));
+		}
+	}
+
+	if (hud_loaded) {
+		Hand shown;
+		shown.type = 3;
+		shown.location = Point(input.frame.cols / 3, input.frame.rows / 3);
+		Rect shown_box(shown.location, Size(input.frame.cols / 4, input.frame.rows / 4));
+		results.push_back(TimeStage("DrawHandInfo", input, input.frame, frame_bytes, bench_repeats,
+			[&](Mat& image) { DrawHandInfo(image, shown, 2, shown_box); }));
+	}
+
+	VideoWriter writer(encode_path, VideoWriter::fourcc('M', 'J', 'P', 'G'), 30, input.frame.size());
+	if (writer.isOpened()) {
+		results.push_back(TimeStage("VideoWriter", input, input.frame, frame_bytes, bench_repeats,
+			[&](Mat& image) { writer.write(image); }));
+		writer.release();
+		remove(encode_path.c_str());
+	}
+}
+
+// ScheduleAgreement
+// Precondition: types, locations and milliseconds hold the every frame detection of a video, analyzed
+//               says which frames a schedule analyzes
+// Postcondition: Returns the schedule's result. A frame that is not analyzed shows the last analyzed
+//                hand, as Main draws it, and agrees if that is the hand every frame analysis found.
+ScheduleResult ScheduleAgreement(const string& schedule_name, const string& input, const vector<int>& types,
+	const vector<Point>& locations, const vector<double>& milliseconds, const vector<bool>& analyzed,
+	int const frame_width) {
+	ScheduleResult result;
+	result.schedule = schedule_name;
+	result.input = input;
+	result.frames = (int)types.size();
+	int const tolerance = (int)(frame_width * schedule_location_tolerance);
+	int shown_type = -1;
+	Point shown_location(-1, -1);
+	int agreed = 0;
+	for (size_t i = 0; i < types.size(); i++) {
+		if (analyzed[i]) {
+			shown_type = types[i];
+			shown_location = locations[i];
+			result.analyzed++;
+			result.analyze_s += milliseconds[i] / 1000.0;
+		}
+		if (shown_type != types[i]) continue;
+		if (shown_type == -1 || (abs(shown_location.x - locations[i].x) <= tolerance &&
+			abs(shown_location.y - locations[i].y) <= tolerance)) agreed++;
+	}
+	result.agreement = result.frames > 0 ? (double)agreed / result.frames : 0;
+	return result;
+}
+
+// CompareSchedules
+// Precondition: None
+// Postcondition: The detection is run on every frame of video_path against its extracted background.
+//                For each of schedule_skips, analyzing every that many frames as Main does, and for the
+//                adaptive scheduler, how often the shown hand agrees with it and how many frames are
+//                analyzed is added to schedules. Nothing is added if the video can not be read.
+void CompareSchedules(const string& video_path, vector<ScheduleResult>& schedules) {
+	VideoCapture video(video_path);
+	if (!video.isOpened()) return;
+	Mat background = ExtractBackground(video);
+	PrepareImage(background);
+	FrameScheduler scheduler;
+	double const fps = video.get(CAP_PROP_FPS);
+	if (fps > 0) scheduler.frame_budget_ms = 1000.0 / fps;
+
+	vector<int> types;
+	vector<Point> locations;
+	vector<double> milliseconds;
+	vector<bool> adaptive;
+	Mat frame;
+	Mat prepared;
+	Mat mask;
+	vector<vector<Point>> contours;
+	vector<ContourCandidate> candidates;
+	DetectorScratch scratch;
+	Rect box;
+	for (;;) {
+		video >> frame;
+		if (frame.empty()) break;
+		bool const analyze = ShouldAnalyze(scheduler, frame);
+		int64 const begin = getTickCount();
+		frame.copyTo(prepared);
+		PrepareImage(prepared);
+		BackgroundRemover(prepared, background, mask);
+		ExtractHandCandidates(mask, mask.rows * mask.cols, contours, candidates, scratch);
+		Hand const hand = SearchForHand(contours, candidates, box, scratch);
+		double const taken = (getTickCount() - begin) * 1000.0 / getTickFrequency();
+		if (analyze) RecordAnalysis(scheduler, taken);
+		types.push_back(hand.type);
+		locations.push_back(hand.location);
+		milliseconds.push_back(taken);
+		adaptive.push_back(analyze);
+	}
+
+	for (size_t s = 0; s < schedule_skips.size(); s++) {
+		vector<bool> fixed(types.size());
+		for (size_t i = 0; i < fixed.size(); i++) fixed[i] = (i + 1) % schedule_skips[s] == 0;	// Main's frame_num
+		schedules.push_back(ScheduleAgreement("skip " + to_string(schedule_skips[s]), video_path, types, locations,
+			milliseconds, fixed, background.cols));
+	}
+	schedules.push_back(ScheduleAgreement("adaptive", video_path, types, locations, milliseconds, adaptive,
+		background.cols));
+}
+
+// WriteResults
+// Precondition: file_name ends in .json
+// Postcondition: results, smoothing and schedules are written to file_name as JSON lists. Returns false
+//                if it can not be written.
+bool WriteResults(const string& file_name, const vector<StageResult>& results,
+	const vector<SmoothingResult>& smoothing, const vector<ScheduleResult>& schedules) {
+	FileStorage storage(file_name, FileStorage::WRITE | FileStorage::FORMAT_JSON);
+	if (!storage.isOpened()) return false;
+	storage << "results" << "[";
+	for (size_t i = 0; i < results.size(); i++) {
+		storage << "{" << "stage" << results[i].stage << "input" << results[i].input << "size" << results[i].size
+			<< "median_ms" << results[i].median_ms << "p95_ms" << results[i].p95_ms
+			<< "mb_per_s" << results[i].mb_per_s << "}";
+	}
+	storage << "]";
+	storage << "smoothing" << "[";
+	for (size_t i = 0; i < smoothing.size(); i++) {
+		storage << "{" << "backend" << smoothing[i].backend << "input" << smoothing[i].input
+			<< "size" << smoothing[i].size << "agreement" << smoothing[i].agreement
+			<< "overlap" << smoothing[i].overlap << "}";
+	}
+	storage << "]";
+	storage << "schedules" << "[";
+	for (size_t i = 0; i < schedules.size(); i++) {
+		storage << "{" << "schedule" << schedules[i].schedule << "input" << schedules[i].input
+			<< "frames" << schedules[i].frames << "analyzed" << schedules[i].analyzed
+			<< "agreement" << schedules[i].agreement << "analyze_s" << schedules[i].analyze_s << "}";
+	}
+	storage << "]";
+	storage.release();
+	return true;
+}
+
+// CompareWithBaseline
+// Precondition: file_name is a JSON file written by WriteResults
+// Postcondition: Prints the change in median time of every stage also in the baseline. Returns the
+//                number of stages slower than the baseline by more than regression, or -1 if the
+//                baseline can not be read.
+int CompareWithBaseline(const string& file_name, const vector<StageResult>& results, double const regression) {
+	FileStorage storage(file_name, FileStorage::READ);
+	if (!storage.isOpened()) return -1;
+	FileNode saved = storage["results"];
+	map<string, double> baseline;
+	for (int i = 0; i < (int)saved.size(); i++) {
+		FileNode entry = saved[i];
+		baseline[(string)entry["stage"] + "|" + (string)entry["input"] + "|" + (string)entry["size"]] =
+			(double)entry["median_ms"];
+	}
+
+	int slower = 0;
+	printf("\n%-40s %-24s %-10s %10s %10s %8s\n", "stage", "input", "size", "base ms", "ms", "change");
+	for (size_t i = 0; i < results.size(); i++) {
+		auto found = baseline.find(results[i].stage + "|" + results[i].input + "|" + results[i].size);
+		if (found == baseline.end() || found->second <= 0) continue;
+		double change = results[i].median_ms / found->second - 1;
+		bool regressed = change > regression;
+		if (regressed) slower++;
+		printf("%-40s %-24s %-10s %10.3f %10.3f %+7.1f%%%s\n", results[i].stage.c_str(), results[i].input.c_str(),
+			results[i].size.c_str(), found->second, results[i].median_ms, change * 100, regressed ? " slower" : "");
+	}
+	return slower;
+}
+
+// Main Method - Benchmark
+// Precondition: Arguments are optional: --out results.json, --baseline baseline.json and --threshold
+//               followed by the share a stage may slow down before it counts as slower (default 0.10)
+// Postcondition: Every stage is timed on every input and the frame schedules are compared, tables are
+//                printed and the results are written as JSON. With a baseline the changes are printed,
+//                and -1 is returned if a stage got slower.
+int main(int argc, char** argv) {
+	string out_file = "stage_results.json";
+	string baseline_file;
+	double regression = default_regression;
+	for (int i = 1; i + 1 < argc; i += 2) {
+		string option = argv[i];
+		if (option == "--out") out_file = argv[i + 1];
+		else if (option == "--baseline") baseline_file = argv[i + 1];
+		else if (option == "--threshold") regression = atof(argv[i + 1]);
+	}
+
+	bool const hud_loaded = LoadHudAssets();
+	vector<BenchInput> inputs = LoadBenchInputs();
+	if (inputs.empty()) {
+		cout << "No videos or stills to benchmark" << endl;
+		return -1;
+	}
+
+	vector<StageResult> results;
+	vector<SmoothingResult> smoothing;
+	for (size_t v = 0; v < video_paths.size(); v++) {
+		VideoCapture video(video_paths[v]);
+		if (!video.isOpened()) continue;
+		BenchInput source;
+		source.name = video_paths[v];
+		source.frame = Mat(Size((int)video.get(CAP_PROP_FRAME_WIDTH), (int)video.get(CAP_PROP_FRAME_HEIGHT)), CV_8UC3);
+		double const video_bytes = (double)source.frame.total() * 3 * video.get(CAP_PROP_FRAME_COUNT);
+		results.push_back(TimeStage("ExtractBackground", source, Mat(), video_bytes, background_repeats,
+			[&](Mat&) {
+				video.set(CAP_PROP_POS_FRAMES, 0);
+				ExtractBackground(video);
+			}));
+	}
+	for (size_t i = 0; i < inputs.size(); i++) {
+		BenchInputStages(inputs[i], hud_loaded, results, smoothing);
+	}
+	vector<ScheduleResult> schedules;
+	for (size_t v = 0; v < video_paths.size(); v++) CompareSchedules(video_paths[v], schedules);
+
+	printf("%-40s %-24s %-10s %10s %10s %10s\n", "stage", "input", "size", "median ms", "p95 ms", "MB/s");
+	for (size_t i = 0; i < results.size(); i++) {
+		printf("%-40s %-24s %-10s %10.3f %10.3f %10.1f\n", results[i].stage.c_str(), results[i].input.c_str(),
+			results[i].size.c_str(), results[i].median_ms, results[i].p95_ms, results[i].mb_per_s);
+	}
+	printf("\n%-40s %-24s %-10s %10s %10s\n", "smoothing", "input", "size", "agree %", "overlap %");
+	for (size_t i = 0; i < smoothing.size(); i++) {
+		printf("%-40s %-24s %-10s %10.3f %10.2f\n", smoothing[i].backend.c_str(), smoothing[i].input.c_str(),
+			smoothing[i].size.c_str(), smoothing[i].agreement * 100, smoothing[i].overlap * 100);
+	}
+	printf("\n%-40s %-24s %10s %10s %10s %12s\n", "schedule", "input", "frames", "analyzed", "agree %",
+		"analyze s");
+	for (size_t i = 0; i < schedules.size(); i++) {
+		printf("%-40s %-24s %10d %10d %10.2f %12.3f\n", schedules[i].schedule.c_str(), schedules[i].input.c_str(),
+			schedules[i].frames, schedules[i].analyzed, schedules[i].agreement * 100, schedules[i].analyze_s);
+	}
+	if (!WriteResults(out_file, results, smoothing, schedules)) cout << "Could not write " << out_file << endl;
+
+	if (!baseline_file.empty()) {
+		int slower = CompareWithBaseline(baseline_file, results, regression);
+		if (slower < 0) {
+			cout << "Could not read " << baseline_file << endl;
+			return -1;
+		}
+		if (slower > 0) return -1;
+	}
+	return 0;
+}
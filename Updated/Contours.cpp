@@ -1,5 +1,6 @@
 // Contains contour operations for Hand Detection. Such as finding the image contours in given image, 
 //  finding the nth biggest contours in a given list of contours, and determining which contour is bigger.
+//  Hand candidates can also come straight from the mask's connected components.
 // Author: Quintin Nguyen, Akhil Lal, Matthew Cho
 
 #include <opencv2/core.hpp>
@@ -15,6 +16,7 @@
 #include <opencv2/videoio.hpp>
 #include <opencv2/video.hpp>
 #include "Hand.h"
+#include "RunMask.h"
 using namespace cv;
 using namespace std;
 
@@ -25,6 +27,12 @@ using namespace std;
 //#define MOVE_RIGHT 4;
 
 double const min_contour_area_percent = 0.04;
+int const max_hand_candidates = 8;
+
+void SelectHandCandidates(const vector<vector<Point>>& contours, const int area,
+	vector<ContourCandidate>& candidates);
+static void KeepBiggestCandidates(vector<ContourCandidate>& candidates);
+static Mat ScratchView(Mat& buffer, const Size& size, int const type);
 
 // Finds the image contours in the given image and puts them in a vector, and returns it
 // Preconditions: image is of the correct type and correctly allocated
@@ -38,6 +46,20 @@ vector<vector<Point>> FindImageContours(const Mat& object) {
 	return contours;
 }
 
+// Finds the image contours in the given image and puts them in contours
+// Preconditions: image is of the correct type and correctly allocated
+// Postconditions: contours holds the same contours FindImageContours returns. The thresholded image
+//                 goes into the top left of scratch.thresh, which only grows, and contours and
+//                 scratch.hierarchy keep their memory from the previous frame.
+void FindImageContours(const Mat& object, vector<vector<Point>>& contours, DetectorScratch& scratch) {
+	if (scratch.thresh.rows < object.rows || scratch.thresh.cols < object.cols) {
+		scratch.thresh.create(max(scratch.thresh.rows, object.rows), max(scratch.thresh.cols, object.cols), CV_8U);
+	}
+	Mat thresh = scratch.thresh(Rect(0, 0, object.cols, object.rows));
+	threshold(object, thresh, 90, 255, THRESH_BINARY);
+	findContours(thresh, contours, scratch.hierarchy, RETR_TREE, CHAIN_APPROX_SIMPLE);
+}
+
 // Finds the nth biggest contour in the given list of contours, biggest is determined by rectangular area of the contour
 // Preconditions: contours list and box is of the correct type and are correctly allocated, n is an constant integer
 // Postconditions: Returns the index of the nth biggest contour
@@ -54,8 +76,145 @@ int FindNthBiggestContour(const vector<vector<Point>>& contours, Rect& box, cons
 // Preconditions: contour1 and contour2 are of the correct type and are correctly allocated
 // Postconditions: Returns true if contour2 is bigger than contour1, false if not
 // Credit: StackOverFlow User dom
-bool CompareContourAreas(const vector<Point> contour1, const vector<Point> contour2) {
+bool CompareContourAreas(const vector<Point>& contour1, const vector<Point>& contour2) {
 	double i = fabs(contourArea(Mat(contour1)));
 	double j = fabs(contourArea(Mat(contour2)));
 	return (i < j);
 }
+
+// SelectHandCandidates
+// Preconditions: contours is of the correct type and correctly allocated, area is the area of the image
+// Postconditions: Returns up to max_hand_candidates contours, biggest first, whose area is at least
+//                 min_contour_area_percent of area. Each area is only computed once, contours that
+//                 are too small are dropped right away and only the kept ones get a box.
+vector<ContourCandidate> SelectHandCandidates(const vector<vector<Point>>& contours, const int area) {
+	vector<ContourCandidate> candidates;
+	SelectHandCandidates(contours, area, candidates);
+	return candidates;
+}
+
+// SelectHandCandidates
+// Preconditions: Same as SelectHandCandidates
+// Postconditions: candidates holds what SelectHandCandidates returns, reusing its memory
+void SelectHandCandidates(const vector<vector<Point>>& contours, const int area,
+	vector<ContourCandidate>& candidates) {
+	candidates.clear();
+	double const min_area = area * min_contour_area_percent;
+	for (int i = 0; i < (int)contours.size(); i++) {
+		ContourCandidate candidate;
+		candidate.area = contourArea(contours[i]);
+		if (candidate.area >= min_area) {
+			candidate.index = i;
+			candidates.push_back(candidate);
+		}
+	}
+
+	KeepBiggestCandidates(candidates);
+	for (int i = 0; i < (int)candidates.size(); i++) {
+		candidates[i].box = boundingRect(contours[candidates[i].index]);
+	}
+}
+
+// KeepBiggestCandidates
+// Preconditions: candidates have their area set
+// Postconditions: Only the max_hand_candidates biggest candidates are left, biggest first
+static void KeepBiggestCandidates(vector<ContourCandidate>& candidates) {
+	auto bigger = [](const ContourCandidate& a, const ContourCandidate& b) { return a.area > b.area; };
+	if ((int)candidates.size() > max_hand_candidates) {
+		nth_element(candidates.begin(), candidates.begin() + max_hand_candidates, candidates.end(), bigger);
+		candidates.resize(max_hand_candidates);
+	}
+	sort(candidates.begin(), candidates.end(), bigger);
+}
+
+// ExtractHandCandidates
+// Preconditions: mask is a binary image of 0 and 255, area is the area of the image
+// Postconditions: candidates holds up to max_hand_candidates connected components of mask, biggest
+//                 first, of at least min_contour_area_percent of area. Their area is the pixel count,
+//                 box and centroid are summed from the runs of each label in one pass over the labels.
+//                 contours holds only the outer contour of each kept component, at the candidate's
+//                 index. Specks and holes are never traced. The labels go into scratch.labels, which
+//                 only grows, so a mask of a new size does not allocate.
+void ExtractHandCandidates(const Mat& mask, const int area, vector<vector<Point>>& contours,
+	vector<ContourCandidate>& candidates, DetectorScratch& scratch) {
+	Mat labels = ScratchView(scratch.labels, mask.size(), CV_32S);
+	int const count = connectedComponents(mask, labels, 8, CV_32S);
+	candidates.assign(max(count - 1, 0), ContourCandidate());	// Label 0 is the background
+	for (int row = 0; row < labels.rows; row++) {
+		const int* label = labels.ptr<int>(row);
+		int col = 0;
+		while (col < labels.cols) {
+			int const start = col;
+			int const current = label[col];
+			while (col < labels.cols && label[col] == current) col++;
+			if (current == 0) continue;
+			ContourCandidate& candidate = candidates[current - 1];
+			int const length = col - start;
+			Rect const span(start, row, length, 1);
+			if (candidate.area == 0) candidate.box = span;
+			else candidate.box |= span;
+			candidate.area += length;
+			candidate.centroid.x += (start + col - 1) * 0.5 * length;
+			candidate.centroid.y += (double)row * length;
+		}
+	}
+	for (int i = 0; i < (int)candidates.size(); i++) {
+		candidates[i].index = i + 1;
+		candidates[i].centroid.x /= candidates[i].area;
+		candidates[i].centroid.y /= candidates[i].area;
+	}
+	double const min_area = area * min_contour_area_percent;
+	candidates.erase(remove_if(candidates.begin(), candidates.end(),
+		[&](const ContourCandidate& candidate) { return candidate.area < min_area; }), candidates.end());
+	KeepBiggestCandidates(candidates);
+
+	// Trace each kept component alone inside its box, other components there are left out by label
+	contours.resize(candidates.size());
+	for (int i = 0; i < (int)candidates.size(); i++) {
+		ContourCandidate& candidate = candidates[i];
+		const Rect& box = candidate.box;
+		Mat component = ScratchView(scratch.component, box.size(), CV_8U);
+		compare(labels(box), Scalar(candidate.index), component, CMP_EQ);
+		findContours(component, scratch.traced, RETR_EXTERNAL, CHAIN_APPROX_SIMPLE, box.tl());
+		contours[i].clear();
+		if (!scratch.traced.empty()) contours[i].swap(scratch.traced[0]);
+		candidate.index = i;
+	}
+}
+
+// ScratchView
+// Preconditions: None
+// Postconditions: Returns a view of size from the top left of buffer, which is only reallocated when
+//                 it is smaller than size in either direction or not of type
+static Mat ScratchView(Mat& buffer, const Size& size, int const type) {
+	if (buffer.type() != type || buffer.rows < size.height || buffer.cols < size.width) {
+		buffer.create(max(buffer.rows, size.height), max(buffer.cols, size.width), type);
+	}
+	return buffer(Rect(Point(0, 0), size));
+}
+
+// ExtractHandCandidates
+// Preconditions: mask is a run length mask, area is the area of the image
+// Postconditions: Same as the ExtractHandCandidates above for the byte image of mask. The components
+//                 come from merging touching runs, and each kept one is drawn from its own runs to
+//                 be traced.
+void ExtractHandCandidates(const RunMask& mask, const int area, vector<vector<Point>>& contours,
+	vector<ContourCandidate>& candidates, DetectorScratch& scratch) {
+	LabelRunMask(mask, scratch.run_labels, candidates);
+	double const min_area = area * min_contour_area_percent;
+	candidates.erase(remove_if(candidates.begin(), candidates.end(),
+		[&](const ContourCandidate& candidate) { return candidate.area < min_area; }), candidates.end());
+	KeepBiggestCandidates(candidates);
+
+	contours.resize(candidates.size());
+	for (int i = 0; i < (int)candidates.size(); i++) {
+		ContourCandidate& candidate = candidates[i];
+		const Rect& box = candidate.box;
+		Mat component = ScratchView(scratch.component, box.size(), CV_8U);
+		DrawRunComponent(mask, scratch.run_labels, candidate.index, box, component);
+		findContours(component, scratch.traced, RETR_EXTERNAL, CHAIN_APPROX_SIMPLE, box.tl());
+		contours[i].clear();
+		if (!scratch.traced.empty()) contours[i].swap(scratch.traced[0]);
+		candidate.index = i;
+	}
+}
@@ -0,0 +1,34 @@
+// Contains the function that sizes the FramePool for Hand Detection, once per video before its first
+//  frame is read.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#include "FramePool.h"
+
+int const pool_contours = 256;		// Contours room is kept for, more only allocate on the frames that have them
+int const pool_candidates = 64;
+int const pool_runs_per_row = 4;	// A hand crosses a row a few times, noise makes more
+
+// AllocateFramePool
+// Precondition: frame_size is the size of the video's frames and scale is the pyramid scale, 1 for none
+// Postcondition: Every buffer of pool has the size the frame loop will use, and its lists have room
+//                for a busy frame, so frames after the first few do not allocate
+void AllocateFramePool(FramePool& pool, const Size& frame_size, int const scale) {
+	Size const work_size(frame_size.width / scale, frame_size.height / scale);
+	pool.original.create(frame_size, CV_8UC3);
+	if (scale > 1) pool.coarse.create(work_size, CV_8UC3);
+	pool.warmup.create(work_size, CV_8UC3);
+	pool.region.create(work_size, CV_8UC3);
+	pool.mask.create(work_size, CV_8U);
+	ClearRunMask(pool.runs, work_size);
+	pool.runs.runs.reserve(work_size.height * pool_runs_per_row);
+	pool.contours.reserve(pool_contours);
+	pool.candidates.reserve(pool_candidates);
+
+	DetectorScratch& detector = pool.detector;
+	detector.object.create(work_size, CV_8U);
+	detector.thresh.create(work_size, CV_8U);
+	detector.labels.create(work_size, CV_32S);
+	detector.hierarchy.reserve(pool_contours);
+	detector.top.reserve(work_size.width);
+	detector.top_edge.reserve(work_size.width);
+}
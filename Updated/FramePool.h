@@ -0,0 +1,28 @@
+// Contains the FramePool struct for Hand Detection. Struct holds every buffer the frame loop writes
+//  into, sized once when the video is opened so each frame reuses them instead of allocating. The
+//  tracked region and its mask are views of the top left of full size buffers.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#pragma once
+#include "Hand.h"
+#include "RunMask.h"
+
+struct FramePool {
+	Mat original;		// The frame the hand info is drawn on
+	Mat coarse;			// The frame shrunk by the pyramid scale
+	Mat warmup;			// A prepared frame going into the background model while it warms up
+	Mat region;			// The tracked region of the frame being worked on
+	Mat mask;			// The foreground of region, or of the whole frame
+	RunMask runs;		// The same foreground as runs, with run_length_mask
+	Mat refine_mask;
+	vector<vector<Point>> contours;
+	vector<ContourCandidate> candidates;
+	DetectorScratch detector;
+};
+
+// PoolView
+// Precondition: buffer is at least size in each direction
+// Postcondition: Returns a view of the top left size of buffer, which shares its memory
+inline Mat PoolView(const Mat& buffer, const Size& size) {
+	return buffer(Rect(Point(0, 0), size));
+}
@@ -0,0 +1,88 @@
+// Contains the adaptive frame scheduler for Hand Detection. Decides for each frame whether the full
+//  detection runs from how much the frame moved since the last one and how much time there is left,
+//  so fast movement is analyzed often and a still scene rarely.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#include <opencv2/core.hpp>
+#include <opencv2/highgui.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/features2d.hpp>
+#include <iostream>
+#include <cmath>
+#include <opencv2/core/types.hpp>
+#include <vector>
+#include <stdlib.h>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/videoio.hpp>
+#include <opencv2/video.hpp>
+#include "Hand.h"
+#include "FrameScheduler.h"
+using namespace cv;
+using namespace std;
+
+int const motion_sample_width = 64;		// Width the frame is shrunk to before measuring motion
+double const motion_still_level = 1.0;	// Motion at or below this is analyzed every max_analyze_interval
+double const motion_fast_level = 8.0;	// Motion at or above this is analyzed every frame
+int const max_analyze_interval = 8;
+double const analyze_time_weight = 0.1;	// Weight of the newest analysis in the running average
+
+
+// MeasureMotion
+// Precondition: frame is a colored image, every frame of the video is passed in order
+// Postcondition: Returns the mean absolute difference in gray level between frame and the frame
+//                before it, both shrunk to motion_sample_width wide. The first frame has no motion.
+//                The gray frame and the previous one trade buffers, so nothing is allocated once
+//                both exist.
+double MeasureMotion(FrameScheduler& scheduler, const Mat& frame) {
+	int const width = min(motion_sample_width, frame.cols);
+	int const height = max(1, frame.rows * width / frame.cols);
+	resize(frame, scheduler.small, Size(width, height), 0, 0, INTER_AREA);
+	cvtColor(scheduler.small, scheduler.gray, COLOR_BGR2GRAY);
+
+	double motion = 0;
+	if (!scheduler.previous_small.empty()) {
+		absdiff(scheduler.gray, scheduler.previous_small, scheduler.difference);
+		motion = mean(scheduler.difference)[0];
+	}
+	swap(scheduler.previous_small, scheduler.gray);
+	return motion;
+}
+
+// ShouldAnalyze
+// Precondition: frame is a colored image, every frame of the video is passed in order
+// Postcondition: Returns true if the full detection should run on frame. The more the frame moved
+//                the fewer frames are skipped, between every frame and max_analyze_interval. Frames
+//                are skipped anyway while an analysis would take longer than the frames it covers.
+bool ShouldAnalyze(FrameScheduler& scheduler, const Mat& frame) {
+	scheduler.motion = MeasureMotion(scheduler, frame);
+	scheduler.frames++;
+	scheduler.since_analyzed++;
+
+	double fast = (scheduler.motion - motion_still_level) / (motion_fast_level - motion_still_level);
+	fast = min(1.0, max(0.0, fast));
+	int interval = (int)cvRound(max_analyze_interval - fast * (max_analyze_interval - 1));
+	if (scheduler.frame_budget_ms > 0) {
+		interval = max(interval, (int)ceil(scheduler.analyze_ms / scheduler.frame_budget_ms));
+	}
+	interval = min(interval, max_analyze_interval);
+	return scheduler.since_analyzed >= interval;
+}
+
+// RecordAnalysis
+// Precondition: The full detection was just run on a frame and took milliseconds
+// Postcondition: The analysis is counted and its time goes into the running average
+void RecordAnalysis(FrameScheduler& scheduler, const double milliseconds) {
+	if (scheduler.analyzed == 0) scheduler.analyze_ms = milliseconds;
+	else scheduler.analyze_ms += analyze_time_weight * (milliseconds - scheduler.analyze_ms);
+	scheduler.analyzed++;
+	scheduler.since_analyzed = 0;
+}
+
+// PrintSchedulerReport
+// Precondition: scheduler was used for the whole video
+// Postcondition: Prints how many of the frames were analyzed and how long an analysis took
+void PrintSchedulerReport(const FrameScheduler& scheduler) {
+	double rate = scheduler.frames > 0 ? 100.0 * scheduler.analyzed / scheduler.frames : 0;
+	cout << "Analyzed " << scheduler.analyzed << " of " << scheduler.frames << " frames (" << rate
+		<< "%), " << scheduler.analyze_ms << " ms per analysis" << endl;
+}
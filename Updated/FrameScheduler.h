@@ -0,0 +1,20 @@
+// Contains the FrameScheduler struct for Hand Detection. Struct holds what is needed to decide, frame by
+//  frame, whether to run the full detection: a small copy of the last frame to measure motion against,
+//  how long an analysis takes and how much time each frame is given.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#pragma once
+#include "Hand.h"
+
+struct FrameScheduler {
+	double frame_budget_ms = 1000.0 / 30;	// Time each frame of the video is given
+	Mat previous_small;		// Last frame shrunk and in grayscale
+	Mat small;				// Buffers the next frame is shrunk and compared in, reused every frame
+	Mat gray;
+	Mat difference;
+	double motion = 0;		// Mean difference between the last two small frames
+	double analyze_ms = 0;	// Running average of how long one analysis takes
+	int since_analyzed = 0;	// Frames seen since the last analysis
+	int frames = 0;
+	int analyzed = 0;
+};
@@ -1,4 +1,6 @@
-// Contains the Hand struct for Hand Detection. Struct contains location of hand and position.
+// Contains the Hand struct for Hand Detection. Struct contains location of hand and position. Also
+//  contains the ContourCandidate struct for contours that could be the hand, and the DetectorScratch
+//  struct, which holds the buffers one detector reuses between frames.
 // Author: Quintin Nguyen, Akhil Lal, Matthew Cho
 
 #pragma once
@@ -21,3 +23,22 @@ struct Hand {
 	Point location = Point(-1, -1);
 	int type = -1;
 };
+
+struct ContourCandidate {
+	int index = -1;		// Position of the contour in its list
+	double area = 0;
+	Rect box;
+	Point2d centroid;	// Center of its pixels, only set by ExtractHandCandidates
+};
+
+struct DetectorScratch {
+	Mat object;		// Grows to the biggest candidate box, each candidate is drawn into its corner
+	Mat thresh;		// Grows to the biggest mask, the thresholded mask contours are found in
+	vector<Vec4i> hierarchy;
+	vector<int> top;		// Top edge of the candidate being tried, one entry per sampled column
+	vector<Point> top_edge;
+	Mat labels;		// Grows to the biggest mask, its connected component labels are written in its corner
+	Mat component;	// Grows to the biggest candidate box, the candidate alone is traced from its corner
+	vector<vector<Point>> traced;
+	vector<int> run_labels;	// Component of each run of a run length mask
+};
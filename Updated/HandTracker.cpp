@@ -0,0 +1,71 @@
+// Contains the hand tracker for Hand Detection. Predicts from the last box and its movement where the
+//  hand will be in the next analyzed frame, so the analysis can run only around it. The whole frame is
+//  searched again every so often and whenever the hand is lost.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#include <opencv2/core.hpp>
+#include <opencv2/highgui.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/features2d.hpp>
+#include <iostream>
+#include <cmath>
+#include <opencv2/core/types.hpp>
+#include <vector>
+#include <stdlib.h>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/videoio.hpp>
+#include <opencv2/video.hpp>
+#include "Hand.h"
+#include "HandTracker.h"
+using namespace cv;
+using namespace std;
+
+int const track_refresh_analyses = 15;	// Analyses between searches of the whole frame
+double const track_margin_scale = 0.5;	// Margin around the predicted box, as a share of its size
+int const track_min_margin = 32;
+
+
+// PredictHandRegion
+// Precondition: tracker was updated after every analysis, frame_size is the size of the frames
+// Postcondition: Returns the part of the frame the next analysis should cover. That is the last box
+//                moved by the last movement and grown by a margin, or the whole frame when no hand
+//                is tracked or it is time for a full search.
+Rect PredictHandRegion(const HandTracker& tracker, const Size& frame_size) {
+	Rect frame(0, 0, frame_size.width, frame_size.height);
+	if (!tracker.tracking || tracker.since_full >= track_refresh_analyses) return frame;
+
+	int const margin_x = max(track_min_margin, (int)(tracker.box.width * track_margin_scale)) +
+		abs(tracker.velocity.x);
+	int const margin_y = max(track_min_margin, (int)(tracker.box.height * track_margin_scale)) +
+		abs(tracker.velocity.y);
+	Rect region(tracker.box.x + tracker.velocity.x - margin_x, tracker.box.y + tracker.velocity.y - margin_y,
+		tracker.box.width + 2 * margin_x, tracker.box.height + 2 * margin_y);
+	region &= frame;
+	return region.empty() ? frame : region;
+}
+
+// UpdateHandTracker
+// Precondition: hand and box are the result of analyzing region of a frame, box in frame coordinates
+// Postcondition: tracker follows the hand if it was found, and stops tracking if it was not. If the
+//                box touches the edge of region inside the frame, the hand may be cut off, so the
+//                next analysis covers the whole frame.
+void UpdateHandTracker(HandTracker& tracker, const Hand& hand, const Rect& box, const Rect& region,
+	const Size& frame_size) {
+	bool const full = (region.width == frame_size.width && region.height == frame_size.height);
+	tracker.since_full = full ? 0 : tracker.since_full + 1;
+
+	if (hand.type == -1) {
+		tracker.tracking = false;
+		tracker.velocity = Point(0, 0);
+		return;
+	}
+	tracker.velocity = tracker.tracking ? box.tl() - tracker.box.tl() : Point(0, 0);
+	tracker.box = box;
+	tracker.tracking = true;
+
+	bool const cut_off = (box.x <= region.x && region.x > 0) ||
+		(box.y <= region.y && region.y > 0) ||
+		(box.br().x >= region.br().x && region.br().x < frame_size.width) ||
+		(box.br().y >= region.br().y && region.br().y < frame_size.height);
+	if (cut_off) tracker.since_full = track_refresh_analyses;
+}
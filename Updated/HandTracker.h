@@ -0,0 +1,13 @@
+// Contains the HandTracker struct for Hand Detection. Struct holds where the hand was last found and
+//  how it moved, so the next analysis can be limited to the area the hand is expected in.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#pragma once
+#include "Hand.h"
+
+struct HandTracker {
+	Rect box;				// Where the hand was last found, in frame coordinates
+	Point velocity;			// How far box moved between the last two analyses
+	int since_full = 0;		// Analyses since the last one over the whole frame
+	bool tracking = false;	// False until a hand is found, and again whenever it is lost
+};
@@ -0,0 +1,1982 @@
+// Contains the HUD icons none.jpg, stay.jpg and arrow.jpg as JPEG bytes for Hand Detection, so they can
+//  be built into the program instead of read from the code directory. Used when HAND_EMBED_HUD_ICONS
+//  is defined. Made from the .jpg files next to it, remake it if they change.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#pragma once
+
+unsigned char const hud_none_jpg[] = {
+	0xff, 0xd8, 0xff, 0xe1, 0x04, 0xf7, 0x45, 0x78, 0x69, 0x66, 0x00, 0x00, 0x4d, 0x4d, 0x00, 0x2a,
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x01, 0x12, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x1a, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x62, 0x01, 0x1b,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6a, 0x01, 0x28, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x01, 0x31, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00,
+	0x00, 0x72, 0x01, 0x32, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x8f, 0x87, 0x69,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x0a,
+	0xfc, 0x80, 0x00, 0x00, 0x27, 0x10, 0x00, 0x0a, 0xfc, 0x80, 0x00, 0x00, 0x27, 0x10, 0x41, 0x64,
+	0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+	0x20, 0x28, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x00, 0x32, 0x30, 0x32, 0x31, 0x3a,
+	0x31, 0x32, 0x3a, 0x30, 0x35, 0x20, 0x32, 0x30, 0x3a, 0x35, 0x33, 0x3a, 0x30, 0x33, 0x00, 0x00,
+	0x00, 0x03, 0xa0, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00, 0xa0, 0x02,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2d, 0xa0, 0x03, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x03,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x01, 0x1a, 0x00, 0x05, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x1b, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x26, 0x01, 0x28, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x2e, 0x02, 0x02, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x03, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x01, 0xff, 0xd8, 0xff, 0xed, 0x00, 0x0c,
+	0x41, 0x64, 0x6f, 0x62, 0x65, 0x5f, 0x43, 0x4d, 0x00, 0x02, 0xff, 0xee, 0x00, 0x0e, 0x41, 0x64,
+	0x6f, 0x62, 0x65, 0x00, 0x64, 0x80, 0x00, 0x00, 0x00, 0x01, 0xff, 0xdb, 0x00, 0x84, 0x00, 0x0c,
+	0x08, 0x08, 0x08, 0x09, 0x08, 0x0c, 0x09, 0x09, 0x0c, 0x11, 0x0b, 0x0a, 0x0b, 0x11, 0x15, 0x0f,
+	0x0c, 0x0c, 0x0f, 0x15, 0x18, 0x13, 0x13, 0x15, 0x13, 0x13, 0x18, 0x11, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x01,
+	0x0d, 0x0b, 0x0b, 0x0d, 0x0e, 0x0d, 0x10, 0x0e, 0x0e, 0x10, 0x14, 0x0e, 0x0e, 0x0e, 0x14, 0x14,
+	0x0e, 0x0e, 0x0e, 0x0e, 0x14, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x11, 0x11, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x2d, 0x00, 0x2d, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01,
+	0x03, 0x11, 0x01, 0xff, 0xdd, 0x00, 0x04, 0x00, 0x03, 0xff, 0xc4, 0x01, 0x3f, 0x00, 0x00, 0x01,
+	0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x01, 0x00, 0x01, 0x05, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x03, 0x04,
+	0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x10, 0x00, 0x01, 0x04, 0x01, 0x03, 0x02, 0x04, 0x02,
+	0x05, 0x07, 0x06, 0x08, 0x05, 0x03, 0x0c, 0x33, 0x01, 0x00, 0x02, 0x11, 0x03, 0x04, 0x21, 0x12,
+	0x31, 0x05, 0x41, 0x51, 0x61, 0x13, 0x22, 0x71, 0x81, 0x32, 0x06, 0x14, 0x91, 0xa1, 0xb1, 0x42,
+	0x23, 0x24, 0x15, 0x52, 0xc1, 0x62, 0x33, 0x34, 0x72, 0x82, 0xd1, 0x43, 0x07, 0x25, 0x92, 0x53,
+	0xf0, 0xe1, 0xf1, 0x63, 0x73, 0x35, 0x16, 0xa2, 0xb2, 0x83, 0x26, 0x44, 0x93, 0x54, 0x64, 0x45,
+	0xc2, 0xa3, 0x74, 0x36, 0x17, 0xd2, 0x55, 0xe2, 0x65, 0xf2, 0xb3, 0x84, 0xc3, 0xd3, 0x75, 0xe3,
+	0xf3, 0x46, 0x27, 0x94, 0xa4, 0x85, 0xb4, 0x95, 0xc4, 0xd4, 0xe4, 0xf4, 0xa5, 0xb5, 0xc5, 0xd5,
+	0xe5, 0xf5, 0x56, 0x66, 0x76, 0x86, 0x96, 0xa6, 0xb6, 0xc6, 0xd6, 0xe6, 0xf6, 0x37, 0x47, 0x57,
+	0x67, 0x77, 0x87, 0x97, 0xa7, 0xb7, 0xc7, 0xd7, 0xe7, 0xf7, 0x11, 0x00, 0x02, 0x02, 0x01, 0x02,
+	0x04, 0x04, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x06, 0x05, 0x35, 0x01, 0x00, 0x02, 0x11, 0x03,
+	0x21, 0x31, 0x12, 0x04, 0x41, 0x51, 0x61, 0x71, 0x22, 0x13, 0x05, 0x32, 0x81, 0x91, 0x14, 0xa1,
+	0xb1, 0x42, 0x23, 0xc1, 0x52, 0xd1, 0xf0, 0x33, 0x24, 0x62, 0xe1, 0x72, 0x82, 0x92, 0x43, 0x53,
+	0x15, 0x63, 0x73, 0x34, 0xf1, 0x25, 0x06, 0x16, 0xa2, 0xb2, 0x83, 0x07, 0x26, 0x35, 0xc2, 0xd2,
+	0x44, 0x93, 0x54, 0xa3, 0x17, 0x64, 0x45, 0x55, 0x36, 0x74, 0x65, 0xe2, 0xf2, 0xb3, 0x84, 0xc3,
+	0xd3, 0x75, 0xe3, 0xf3, 0x46, 0x94, 0xa4, 0x85, 0xb4, 0x95, 0xc4, 0xd4, 0xe4, 0xf4, 0xa5, 0xb5,
+	0xc5, 0xd5, 0xe5, 0xf5, 0x56, 0x66, 0x76, 0x86, 0x96, 0xa6, 0xb6, 0xc6, 0xd6, 0xe6, 0xf6, 0x27,
+	0x37, 0x47, 0x57, 0x67, 0x77, 0x87, 0x97, 0xa7, 0xb7, 0xc7, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01,
+	0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xf5, 0x55, 0x8d, 0xd6, 0xfe, 0xb4, 0xf4, 0xce,
+	0x8e, 0x7d, 0x2b, 0x09, 0xbf, 0x2a, 0x24, 0x51, 0x5c, 0x48, 0xff, 0x00, 0x8c, 0x77, 0xd1, 0xad,
+	0x2f, 0xad, 0x3d, 0x6c, 0xf4, 0x7e, 0x98, 0x6c, 0xaa, 0x3e, 0xd5, 0x79, 0xf4, 0xf1, 0xc1, 0xd6,
+	0x0c, 0x4b, 0xac, 0x8f, 0xf8, 0x36, 0xaf, 0x2f, 0x7b, 0xde, 0xf7, 0xba, 0xcb, 0x1c, 0x5e, 0xf7,
+	0x92, 0xe7, 0xbd, 0xc6, 0x49, 0x27, 0x97, 0x38, 0xa4, 0xa7, 0xaa, 0xbb, 0xfc, 0x62, 0x75, 0x37,
+	0x3b, 0xf4, 0x38, 0xb4, 0xd6, 0xde, 0xc1, 0xe5, 0xcf, 0x3f, 0x7b, 0x4d, 0x6a, 0xc6, 0x17, 0xf8,
+	0xc5, 0x76, 0xf0, 0xdc, 0xfc, 0x41, 0xb0, 0xf3, 0x65, 0x04, 0x92, 0x3f, 0xeb, 0x56, 0x7f, 0xe9,
+	0x45, 0xc6, 0x24, 0x92, 0x9f, 0x61, 0xc0, 0xea, 0x18, 0x7d, 0x43, 0x1d, 0xb9, 0x38, 0x76, 0x8b,
+	0x6a, 0x77, 0x71, 0xc8, 0x3f, 0xba, 0xf6, 0xfd, 0x26, 0x39, 0x59, 0x5e, 0x4f, 0xd0, 0x7a, 0xd5,
+	0xdd, 0x1b, 0x3d, 0xb9, 0x0d, 0x24, 0xe3, 0xbc, 0x86, 0xe4, 0xd5, 0xd9, 0xcc, 0xfd, 0xef, 0xf8,
+	0xca, 0xff, 0x00, 0x31, 0x7a, 0xaf, 0xad, 0x57, 0xa3, 0xeb, 0xee, 0x1e, 0x96, 0xdd, 0xfb, 0xfb,
+	0x6d, 0x8d, 0xdb, 0xbf, 0xcd, 0x49, 0x4f, 0xff, 0xd0, 0xd6, 0xff, 0x00, 0x18, 0x97, 0x39, 0xdd,
+	0x4f, 0x16, 0x9f, 0xcd, 0xae, 0x92, 0xf0, 0x3c, 0xde, 0xe2, 0xd3, 0xff, 0x00, 0x9e, 0xd7, 0x28,
+	0xbb, 0x3f, 0xf1, 0x8b, 0x84, 0xfd, 0xd8, 0x9d, 0x41, 0xa2, 0x59, 0x06, 0x8b, 0x0f, 0x81, 0x3f,
+	0xa4, 0xab, 0xff, 0x00, 0x46, 0x2e, 0x31, 0x25, 0x29, 0x24, 0x92, 0x49, 0x4a, 0x5d, 0xe7, 0xda,
+	0xec, 0xff, 0x00, 0xc6, 0xef, 0xd5, 0x93, 0xbb, 0xd0, 0xf4, 0x67, 0xbc, 0x7a, 0x9f, 0x67, 0xff,
+	0x00, 0xa8, 0x5c, 0x1e, 0xbd, 0x84, 0x9e, 0xc0, 0x77, 0x3e, 0x0b, 0xd3, 0x7f, 0x62, 0xd9, 0xff,
+	0x00, 0x34, 0x3f, 0x65, 0x47, 0xe9, 0xfe, 0xcf, 0xc7, 0xfc, 0x2f, 0xf3, 0xd1, 0xff, 0x00, 0x6e,
+	0xa4, 0xa7, 0xff, 0xd1, 0xf4, 0xce, 0xa1, 0x81, 0x8f, 0xd4, 0x30, 0xed, 0xc3, 0xc9, 0x6e, 0xea,
+	0xad, 0x10, 0x63, 0x90, 0x7f, 0x35, 0xed, 0xfe, 0x53, 0x5c, 0xbc, 0xc3, 0xad, 0x74, 0x1c, 0xfe,
+	0x8d, 0x71, 0x6e, 0x43, 0x4b, 0xe8, 0x27, 0xf4, 0x59, 0x2d, 0x1e, 0xc7, 0x0f, 0xe5, 0x7f, 0xa3,
+	0xb3, 0xf9, 0x0b, 0xd6, 0x10, 0xee, 0xf4, 0x7d, 0x27, 0x7a, 0xfb, 0x7d, 0x28, 0xf7, 0xef, 0x8d,
+	0xb1, 0xfc, 0xad, 0xde, 0xd4, 0x94, 0xf8, 0xca, 0x5d, 0xc0, 0xee, 0x74, 0x03, 0xb9, 0x2b, 0xbc,
+	0xcb, 0xff, 0x00, 0xc6, 0xef, 0xd4, 0x3e, 0xaf, 0xa1, 0xba, 0x75, 0xf4, 0x7d, 0x48, 0x9f, 0xfd,
+	0x07, 0xf6, 0x2d, 0x1e, 0x8b, 0xff, 0x00, 0x34, 0x3d, 0x51, 0xfb, 0x2b, 0xec, 0xfe, 0xbf, 0x6f,
+	0xf4, 0x9f, 0x2f, 0x5b, 0xf4, 0xa9, 0x29, 0xc3, 0xfa, 0xa5, 0xf5, 0x4a, 0xff, 0x00, 0x5d, 0x9d,
+	0x4f, 0xa9, 0xd6, 0x6b, 0x65, 0x7e, 0xec, 0x7c, 0x77, 0x7d, 0x22, 0xef, 0xcd, 0xb6, 0xd6, 0xfe,
+	0x6b, 0x5b, 0xf9, 0x8c, 0x5d, 0xca, 0x49, 0x24, 0xa7, 0xff, 0xd9, 0xff, 0xed, 0x0c, 0xde, 0x50,
+	0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x33, 0x2e, 0x30, 0x00, 0x38, 0x42, 0x49,
+	0x4d, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1c, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xe8, 0xf1, 0x5c,
+	0xf3, 0x2f, 0xc1, 0x18, 0xa1, 0xa2, 0x7b, 0x67, 0xad, 0xc5, 0x64, 0xd5, 0xba, 0x38, 0x42, 0x49,
+	0x4d, 0x04, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x4f, 0x75, 0x74, 0x70,
+	0x75, 0x74, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x50, 0x73, 0x74, 0x53, 0x62, 0x6f,
+	0x6f, 0x6c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x74, 0x65, 0x65, 0x6e, 0x75, 0x6d, 0x00,
+	0x00, 0x00, 0x00, 0x49, 0x6e, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x43, 0x6c, 0x72, 0x6d, 0x00,
+	0x00, 0x00, 0x0f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x53, 0x69, 0x78, 0x74, 0x65, 0x65, 0x6e, 0x42,
+	0x69, 0x74, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x70, 0x72, 0x69, 0x6e, 0x74,
+	0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x54, 0x45, 0x58, 0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x50, 0x72, 0x6f, 0x6f, 0x66, 0x53, 0x65,
+	0x74, 0x75, 0x70, 0x4f, 0x62, 0x6a, 0x63, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x50, 0x00, 0x72, 0x00,
+	0x6f, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x53, 0x00, 0x65, 0x00, 0x74, 0x00, 0x75, 0x00,
+	0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x70, 0x72, 0x6f, 0x6f, 0x66, 0x53, 0x65, 0x74, 0x75,
+	0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x42, 0x6c, 0x74, 0x6e, 0x65, 0x6e, 0x75,
+	0x6d, 0x00, 0x00, 0x00, 0x0c, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x50, 0x72, 0x6f, 0x6f,
+	0x66, 0x00, 0x00, 0x00, 0x09, 0x70, 0x72, 0x6f, 0x6f, 0x66, 0x43, 0x4d, 0x59, 0x4b, 0x00, 0x38,
+	0x42, 0x49, 0x4d, 0x04, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2d, 0x00, 0x00, 0x00, 0x10, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x4f, 0x75,
+	0x74, 0x70, 0x75, 0x74, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x17, 0x00,
+	0x00, 0x00, 0x00, 0x43, 0x70, 0x74, 0x6e, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x43, 0x6c, 0x62, 0x72, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x67, 0x73,
+	0x4d, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x72, 0x6e, 0x43, 0x62, 0x6f,
+	0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x6e, 0x74, 0x43, 0x62, 0x6f, 0x6f, 0x6c, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x4c, 0x62, 0x6c, 0x73, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4e, 0x67, 0x74, 0x76, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x6d,
+	0x6c, 0x44, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x74, 0x72, 0x62,
+	0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x63, 0x6b, 0x67, 0x4f, 0x62, 0x6a, 0x63,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x47, 0x42, 0x43, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x52, 0x64, 0x20, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x40, 0x6f,
+	0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x72, 0x6e, 0x20, 0x64, 0x6f,
+	0x75, 0x62, 0x40, 0x6f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x6c,
+	0x20, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x40, 0x6f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x42, 0x72, 0x64, 0x54, 0x55, 0x6e, 0x74, 0x46, 0x23, 0x52, 0x6c, 0x74, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x6c, 0x64, 0x20, 0x55, 0x6e,
+	0x74, 0x46, 0x23, 0x52, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x52, 0x73, 0x6c, 0x74, 0x55, 0x6e, 0x74, 0x46, 0x23, 0x50, 0x78, 0x6c, 0x40, 0x52,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72,
+	0x44, 0x61, 0x74, 0x61, 0x62, 0x6f, 0x6f, 0x6c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x50, 0x67, 0x50,
+	0x73, 0x65, 0x6e, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x50, 0x67, 0x50, 0x73, 0x00, 0x00, 0x00,
+	0x00, 0x50, 0x67, 0x50, 0x43, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x65, 0x66, 0x74, 0x55, 0x6e, 0x74,
+	0x46, 0x23, 0x52, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x54, 0x6f, 0x70, 0x20, 0x55, 0x6e, 0x74, 0x46, 0x23, 0x52, 0x6c, 0x74, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x63, 0x6c, 0x20, 0x55, 0x6e, 0x74,
+	0x46, 0x23, 0x50, 0x72, 0x63, 0x40, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x63, 0x72, 0x6f, 0x70, 0x57, 0x68, 0x65, 0x6e, 0x50, 0x72, 0x69, 0x6e, 0x74, 0x69, 0x6e,
+	0x67, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x63, 0x72, 0x6f, 0x70, 0x52, 0x65,
+	0x63, 0x74, 0x42, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0c, 0x63, 0x72, 0x6f, 0x70, 0x52, 0x65, 0x63, 0x74, 0x4c, 0x65, 0x66, 0x74,
+	0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x63, 0x72, 0x6f, 0x70,
+	0x52, 0x65, 0x63, 0x74, 0x52, 0x69, 0x67, 0x68, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x63, 0x72, 0x6f, 0x70, 0x52, 0x65, 0x63, 0x74, 0x54, 0x6f, 0x70,
+	0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x03, 0xed, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x48, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x01, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x38,
+	0x42, 0x49, 0x4d, 0x03, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x5a, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x1e, 0x38, 0x42, 0x49, 0x4d, 0x03, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x27,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x38, 0x42, 0x49, 0x4d, 0x03, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x2f, 0x66,
+	0x66, 0x00, 0x01, 0x00, 0x6c, 0x66, 0x66, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x2f, 0x66, 0x66, 0x00, 0x01, 0x00, 0xa1, 0x99, 0x9a, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x32, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x38, 0x42, 0x49, 0x4d, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x70, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x03, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xe8, 0x00,
+	0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x42, 0x49,
+	0x4d, 0x04, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x38, 0x42, 0x49,
+	0x4d, 0x04, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x6e, 0x75, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x62, 0x6f, 0x75, 0x6e,
+	0x64, 0x73, 0x4f, 0x62, 0x6a, 0x63, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x52, 0x63, 0x74, 0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x6f, 0x70, 0x20,
+	0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x65, 0x66, 0x74,
+	0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x74, 0x6f, 0x6d,
+	0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x52, 0x67, 0x68, 0x74,
+	0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x06, 0x73, 0x6c, 0x69, 0x63,
+	0x65, 0x73, 0x56, 0x6c, 0x4c, 0x73, 0x00, 0x00, 0x00, 0x01, 0x4f, 0x62, 0x6a, 0x63, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x07, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x49, 0x44, 0x6c, 0x6f, 0x6e, 0x67,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x49, 0x44, 0x6c,
+	0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6f, 0x72, 0x69, 0x67, 0x69,
+	0x6e, 0x65, 0x6e, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x0c, 0x45, 0x53, 0x6c, 0x69, 0x63, 0x65, 0x4f,
+	0x72, 0x69, 0x67, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x0d, 0x61, 0x75, 0x74, 0x6f, 0x47, 0x65, 0x6e,
+	0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x65, 0x6e,
+	0x75, 0x6d, 0x00, 0x00, 0x00, 0x0a, 0x45, 0x53, 0x6c, 0x69, 0x63, 0x65, 0x54, 0x79, 0x70, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x49, 0x6d, 0x67, 0x20, 0x00, 0x00, 0x00, 0x06, 0x62, 0x6f, 0x75, 0x6e,
+	0x64, 0x73, 0x4f, 0x62, 0x6a, 0x63, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x52, 0x63, 0x74, 0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x6f, 0x70, 0x20,
+	0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x65, 0x66, 0x74,
+	0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x74, 0x6f, 0x6d,
+	0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x52, 0x67, 0x68, 0x74,
+	0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x03, 0x75, 0x72, 0x6c, 0x54,
+	0x45, 0x58, 0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c,
+	0x6c, 0x54, 0x45, 0x58, 0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d,
+	0x73, 0x67, 0x65, 0x54, 0x45, 0x58, 0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x61, 0x6c, 0x74, 0x54, 0x61, 0x67, 0x54, 0x45, 0x58, 0x54, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0e, 0x63, 0x65, 0x6c, 0x6c, 0x54, 0x65, 0x78, 0x74, 0x49, 0x73, 0x48,
+	0x54, 0x4d, 0x4c, 0x62, 0x6f, 0x6f, 0x6c, 0x01, 0x00, 0x00, 0x00, 0x08, 0x63, 0x65, 0x6c, 0x6c,
+	0x54, 0x65, 0x78, 0x74, 0x54, 0x45, 0x58, 0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x09, 0x68, 0x6f, 0x72, 0x7a, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x65, 0x6e, 0x75, 0x6d, 0x00,
+	0x00, 0x00, 0x0f, 0x45, 0x53, 0x6c, 0x69, 0x63, 0x65, 0x48, 0x6f, 0x72, 0x7a, 0x41, 0x6c, 0x69,
+	0x67, 0x6e, 0x00, 0x00, 0x00, 0x07, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x00, 0x00,
+	0x09, 0x76, 0x65, 0x72, 0x74, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x65, 0x6e, 0x75, 0x6d, 0x00, 0x00,
+	0x00, 0x0f, 0x45, 0x53, 0x6c, 0x69, 0x63, 0x65, 0x56, 0x65, 0x72, 0x74, 0x41, 0x6c, 0x69, 0x67,
+	0x6e, 0x00, 0x00, 0x00, 0x07, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x0b,
+	0x62, 0x67, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x54, 0x79, 0x70, 0x65, 0x65, 0x6e, 0x75, 0x6d, 0x00,
+	0x00, 0x00, 0x11, 0x45, 0x53, 0x6c, 0x69, 0x63, 0x65, 0x42, 0x47, 0x43, 0x6f, 0x6c, 0x6f, 0x72,
+	0x54, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x6f, 0x6e, 0x65, 0x00, 0x00, 0x00, 0x09,
+	0x74, 0x6f, 0x70, 0x4f, 0x75, 0x74, 0x73, 0x65, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0a, 0x6c, 0x65, 0x66, 0x74, 0x4f, 0x75, 0x74, 0x73, 0x65, 0x74, 0x6c,
+	0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x62, 0x6f, 0x74, 0x74, 0x6f,
+	0x6d, 0x4f, 0x75, 0x74, 0x73, 0x65, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0b, 0x72, 0x69, 0x67, 0x68, 0x74, 0x4f, 0x75, 0x74, 0x73, 0x65, 0x74, 0x6c, 0x6f,
+	0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x28, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+	0x42, 0x49, 0x4d, 0x04, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x38, 0x42, 0x49,
+	0x4d, 0x04, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x38, 0x42, 0x49,
+	0x4d, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x03, 0xdd, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x17, 0xe8, 0x00, 0x00, 0x03,
+	0xc1, 0x00, 0x18, 0x00, 0x01, 0xff, 0xd8, 0xff, 0xed, 0x00, 0x0c, 0x41, 0x64, 0x6f, 0x62, 0x65,
+	0x5f, 0x43, 0x4d, 0x00, 0x02, 0xff, 0xee, 0x00, 0x0e, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x00, 0x64,
+	0x80, 0x00, 0x00, 0x00, 0x01, 0xff, 0xdb, 0x00, 0x84, 0x00, 0x0c, 0x08, 0x08, 0x08, 0x09, 0x08,
+	0x0c, 0x09, 0x09, 0x0c, 0x11, 0x0b, 0x0a, 0x0b, 0x11, 0x15, 0x0f, 0x0c, 0x0c, 0x0f, 0x15, 0x18,
+	0x13, 0x13, 0x15, 0x13, 0x13, 0x18, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x11, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x01, 0x0d, 0x0b, 0x0b, 0x0d, 0x0e,
+	0x0d, 0x10, 0x0e, 0x0e, 0x10, 0x14, 0x0e, 0x0e, 0x0e, 0x14, 0x14, 0x0e, 0x0e, 0x0e, 0x0e, 0x14,
+	0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x11, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x11, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xff, 0xc0, 0x00, 0x11, 0x08,
+	0x00, 0x2d, 0x00, 0x2d, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xdd,
+	0x00, 0x04, 0x00, 0x03, 0xff, 0xc4, 0x01, 0x3f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06,
+	0x07, 0x08, 0x09, 0x0a, 0x0b, 0x01, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+	0x0a, 0x0b, 0x10, 0x00, 0x01, 0x04, 0x01, 0x03, 0x02, 0x04, 0x02, 0x05, 0x07, 0x06, 0x08, 0x05,
+	0x03, 0x0c, 0x33, 0x01, 0x00, 0x02, 0x11, 0x03, 0x04, 0x21, 0x12, 0x31, 0x05, 0x41, 0x51, 0x61,
+	0x13, 0x22, 0x71, 0x81, 0x32, 0x06, 0x14, 0x91, 0xa1, 0xb1, 0x42, 0x23, 0x24, 0x15, 0x52, 0xc1,
+	0x62, 0x33, 0x34, 0x72, 0x82, 0xd1, 0x43, 0x07, 0x25, 0x92, 0x53, 0xf0, 0xe1, 0xf1, 0x63, 0x73,
+	0x35, 0x16, 0xa2, 0xb2, 0x83, 0x26, 0x44, 0x93, 0x54, 0x64, 0x45, 0xc2, 0xa3, 0x74, 0x36, 0x17,
+	0xd2, 0x55, 0xe2, 0x65, 0xf2, 0xb3, 0x84, 0xc3, 0xd3, 0x75, 0xe3, 0xf3, 0x46, 0x27, 0x94, 0xa4,
+	0x85, 0xb4, 0x95, 0xc4, 0xd4, 0xe4, 0xf4, 0xa5, 0xb5, 0xc5, 0xd5, 0xe5, 0xf5, 0x56, 0x66, 0x76,
+	0x86, 0x96, 0xa6, 0xb6, 0xc6, 0xd6, 0xe6, 0xf6, 0x37, 0x47, 0x57, 0x67, 0x77, 0x87, 0x97, 0xa7,
+	0xb7, 0xc7, 0xd7, 0xe7, 0xf7, 0x11, 0x00, 0x02, 0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x05,
+	0x06, 0x07, 0x07, 0x06, 0x05, 0x35, 0x01, 0x00, 0x02, 0x11, 0x03, 0x21, 0x31, 0x12, 0x04, 0x41,
+	0x51, 0x61, 0x71, 0x22, 0x13, 0x05, 0x32, 0x81, 0x91, 0x14, 0xa1, 0xb1, 0x42, 0x23, 0xc1, 0x52,
+	0xd1, 0xf0, 0x33, 0x24, 0x62, 0xe1, 0x72, 0x82, 0x92, 0x43, 0x53, 0x15, 0x63, 0x73, 0x34, 0xf1,
+	0x25, 0x06, 0x16, 0xa2, 0xb2, 0x83, 0x07, 0x26, 0x35, 0xc2, 0xd2, 0x44, 0x93, 0x54, 0xa3, 0x17,
+	0x64, 0x45, 0x55, 0x36, 0x74, 0x65, 0xe2, 0xf2, 0xb3, 0x84, 0xc3, 0xd3, 0x75, 0xe3, 0xf3, 0x46,
+	0x94, 0xa4, 0x85, 0xb4, 0x95, 0xc4, 0xd4, 0xe4, 0xf4, 0xa5, 0xb5, 0xc5, 0xd5, 0xe5, 0xf5, 0x56,
+	0x66, 0x76, 0x86, 0x96, 0xa6, 0xb6, 0xc6, 0xd6, 0xe6, 0xf6, 0x27, 0x37, 0x47, 0x57, 0x67, 0x77,
+	0x87, 0x97, 0xa7, 0xb7, 0xc7, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11,
+	0x00, 0x3f, 0x00, 0xf5, 0x55, 0x8d, 0xd6, 0xfe, 0xb4, 0xf4, 0xce, 0x8e, 0x7d, 0x2b, 0x09, 0xbf,
+	0x2a, 0x24, 0x51, 0x5c, 0x48, 0xff, 0x00, 0x8c, 0x77, 0xd1, 0xad, 0x2f, 0xad, 0x3d, 0x6c, 0xf4,
+	0x7e, 0x98, 0x6c, 0xaa, 0x3e, 0xd5, 0x79, 0xf4, 0xf1, 0xc1, 0xd6, 0x0c, 0x4b, 0xac, 0x8f, 0xf8,
+	0x36, 0xaf, 0x2f, 0x7b, 0xde, 0xf7, 0xba, 0xcb, 0x1c, 0x5e, 0xf7, 0x92, 0xe7, 0xbd, 0xc6, 0x49,
+	0x27, 0x97, 0x38, 0xa4, 0xa7, 0xaa, 0xbb, 0xfc, 0x62, 0x75, 0x37, 0x3b, 0xf4, 0x38, 0xb4, 0xd6,
+	0xde, 0xc1, 0xe5, 0xcf, 0x3f, 0x7b, 0x4d, 0x6a, 0xc6, 0x17, 0xf8, 0xc5, 0x76, 0xf0, 0xdc, 0xfc,
+	0x41, 0xb0, 0xf3, 0x65, 0x04, 0x92, 0x3f, 0xeb, 0x56, 0x7f, 0xe9, 0x45, 0xc6, 0x24, 0x92, 0x9f,
+	0x61, 0xc0, 0xea, 0x18, 0x7d, 0x43, 0x1d, 0xb9, 0x38, 0x76, 0x8b, 0x6a, 0x77, 0x71, 0xc8, 0x3f,
+	0xba, 0xf6, 0xfd, 0x26, 0x39, 0x59, 0x5e, 0x4f, 0xd0, 0x7a, 0xd5, 0xdd, 0x1b, 0x3d, 0xb9, 0x0d,
+	0x24, 0xe3, 0xbc, 0x86, 0xe4, 0xd5, 0xd9, 0xcc, 0xfd, 0xef, 0xf8, 0xca, 0xff, 0x00, 0x31, 0x7a,
+	0xaf, 0xad, 0x57, 0xa3, 0xeb, 0xee, 0x1e, 0x96, 0xdd, 0xfb, 0xfb, 0x6d, 0x8d, 0xdb, 0xbf, 0xcd,
+	0x49, 0x4f, 0xff, 0xd0, 0xd6, 0xff, 0x00, 0x18, 0x97, 0x39, 0xdd, 0x4f, 0x16, 0x9f, 0xcd, 0xae,
+	0x92, 0xf0, 0x3c, 0xde, 0xe2, 0xd3, 0xff, 0x00, 0x9e, 0xd7, 0x28, 0xbb, 0x3f, 0xf1, 0x8b, 0x84,
+	0xfd, 0xd8, 0x9d, 0x41, 0xa2, 0x59, 0x06, 0x8b, 0x0f, 0x81, 0x3f, 0xa4, 0xab, 0xff, 0x00, 0x46,
+	0x2e, 0x31, 0x25, 0x29, 0x24, 0x92, 0x49, 0x4a, 0x5d, 0xe7, 0xda, 0xec, 0xff, 0x00, 0xc6, 0xef,
+	0xd5, 0x93, 0xbb, 0xd0, 0xf4, 0x67, 0xbc, 0x7a, 0x9f, 0x67, 0xff, 0x00, 0xa8, 0x5c, 0x1e, 0xbd,
+	0x84, 0x9e, 0xc0, 0x77, 0x3e, 0x0b, 0xd3, 0x7f, 0x62, 0xd9, 0xff, 0x00, 0x34, 0x3f, 0x65, 0x47,
+	0xe9, 0xfe, 0xcf, 0xc7, 0xfc, 0x2f, 0xf3, 0xd1, 0xff, 0x00, 0x6e, 0xa4, 0xa7, 0xff, 0xd1, 0xf4,
+	0xce, 0xa1, 0x81, 0x8f, 0xd4, 0x30, 0xed, 0xc3, 0xc9, 0x6e, 0xea, 0xad, 0x10, 0x63, 0x90, 0x7f,
+	0x35, 0xed, 0xfe, 0x53, 0x5c, 0xbc, 0xc3, 0xad, 0x74, 0x1c, 0xfe, 0x8d, 0x71, 0x6e, 0x43, 0x4b,
+	0xe8, 0x27, 0xf4, 0x59, 0x2d, 0x1e, 0xc7, 0x0f, 0xe5, 0x7f, 0xa3, 0xb3, 0xf9, 0x0b, 0xd6, 0x10,
+	0xee, 0xf4, 0x7d, 0x27, 0x7a, 0xfb, 0x7d, 0x28, 0xf7, 0xef, 0x8d, 0xb1, 0xfc, 0xad, 0xde, 0xd4,
+	0x94, 0xf8, 0xca, 0x5d, 0xc0, 0xee, 0x74, 0x03, 0xb9, 0x2b, 0xbc, 0xcb, 0xff, 0x00, 0xc6, 0xef,
+	0xd4, 0x3e, 0xaf, 0xa1, 0xba, 0x75, 0xf4, 0x7d, 0x48, 0x9f, 0xfd, 0x07, 0xf6, 0x2d, 0x1e, 0x8b,
+	0xff, 0x00, 0x34, 0x3d, 0x51, 0xfb, 0x2b, 0xec, 0xfe, 0xbf, 0x6f, 0xf4, 0x9f, 0x2f, 0x5b, 0xf4,
+	0xa9, 0x29, 0xc3, 0xfa, 0xa5, 0xf5, 0x4a, 0xff, 0x00, 0x5d, 0x9d, 0x4f, 0xa9, 0xd6, 0x6b, 0x65,
+	0x7e, 0xec, 0x7c, 0x77, 0x7d, 0x22, 0xef, 0xcd, 0xb6, 0xd6, 0xfe, 0x6b, 0x5b, 0xf9, 0x8c, 0x5d,
+	0xca, 0x49, 0x24, 0xa7, 0xff, 0xd9, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x21, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x41, 0x00, 0x64,
+	0x00, 0x6f, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x50, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x74,
+	0x00, 0x6f, 0x00, 0x73, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x00, 0x00, 0x12, 0x00, 0x41,
+	0x00, 0x64, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x50, 0x00, 0x68, 0x00, 0x6f,
+	0x00, 0x74, 0x00, 0x6f, 0x00, 0x73, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x20, 0x00, 0x43,
+	0x00, 0x43, 0x00, 0x00, 0x00, 0x01, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x00, 0x08, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0xff, 0xe1, 0x0d, 0x03, 0x68,
+	0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+	0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x00, 0x3c, 0x3f, 0x78, 0x70,
+	0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22, 0xef, 0xbb, 0xbf,
+	0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43, 0x65, 0x68, 0x69,
+	0x48, 0x7a, 0x72, 0x65, 0x53, 0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39, 0x64, 0x22, 0x3f,
+	0x3e, 0x20, 0x3c, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x78, 0x6d, 0x6c,
+	0x6e, 0x73, 0x3a, 0x78, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e, 0x73, 0x3a, 0x6d,
+	0x65, 0x74, 0x61, 0x2f, 0x22, 0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b, 0x3d, 0x22, 0x41,
+	0x64, 0x6f, 0x62, 0x65, 0x20, 0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65, 0x20, 0x35, 0x2e,
+	0x36, 0x2d, 0x63, 0x31, 0x34, 0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30, 0x39, 0x32, 0x34,
+	0x2c, 0x20, 0x32, 0x30, 0x31, 0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d, 0x30, 0x31, 0x3a,
+	0x30, 0x36, 0x3a, 0x33, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x3e, 0x20,
+	0x3c, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x72,
+	0x64, 0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77,
+	0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32, 0x2f, 0x32, 0x32,
+	0x2d, 0x72, 0x64, 0x66, 0x2d, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e, 0x73, 0x23, 0x22,
+	0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69,
+	0x6f, 0x6e, 0x20, 0x72, 0x64, 0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d, 0x22, 0x22, 0x20,
+	0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+	0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78,
+	0x61, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+	0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+	0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+	0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+	0x73, 0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+	0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+	0x68, 0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+	0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+	0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+	0x2e, 0x30, 0x2f, 0x6d, 0x6d, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x73, 0x74,
+	0x45, 0x76, 0x74, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+	0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e, 0x30,
+	0x2f, 0x73, 0x54, 0x79, 0x70, 0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x45,
+	0x76, 0x65, 0x6e, 0x74, 0x23, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64, 0x69, 0x66,
+	0x79, 0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30, 0x32, 0x31, 0x2d, 0x31, 0x32, 0x2d, 0x30,
+	0x35, 0x54, 0x32, 0x30, 0x3a, 0x35, 0x33, 0x3a, 0x30, 0x33, 0x2d, 0x30, 0x38, 0x3a, 0x30, 0x30,
+	0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72, 0x54, 0x6f, 0x6f,
+	0x6c, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+	0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x28, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+	0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+	0x22, 0x32, 0x30, 0x32, 0x31, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x35, 0x54, 0x32, 0x30, 0x3a, 0x33,
+	0x35, 0x3a, 0x31, 0x36, 0x2d, 0x30, 0x38, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+	0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61, 0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+	0x32, 0x31, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x35, 0x54, 0x32, 0x30, 0x3a, 0x35, 0x33, 0x3a, 0x30,
+	0x33, 0x2d, 0x30, 0x38, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66, 0x6f, 0x72, 0x6d,
+	0x61, 0x74, 0x3d, 0x22, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x2f, 0x6a, 0x70, 0x65, 0x67, 0x22, 0x20,
+	0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x4d,
+	0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x49, 0x6e,
+	0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+	0x64, 0x3a, 0x66, 0x63, 0x39, 0x36, 0x32, 0x32, 0x62, 0x32, 0x2d, 0x64, 0x34, 0x37, 0x38, 0x2d,
+	0x36, 0x31, 0x34, 0x34, 0x2d, 0x62, 0x64, 0x30, 0x37, 0x2d, 0x33, 0x65, 0x62, 0x37, 0x39, 0x31,
+	0x62, 0x62, 0x34, 0x37, 0x31, 0x34, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x6f,
+	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+	0x64, 0x3a, 0x66, 0x63, 0x39, 0x36, 0x32, 0x32, 0x62, 0x32, 0x2d, 0x64, 0x34, 0x37, 0x38, 0x2d,
+	0x36, 0x31, 0x34, 0x34, 0x2d, 0x62, 0x64, 0x30, 0x37, 0x2d, 0x33, 0x65, 0x62, 0x37, 0x39, 0x31,
+	0x62, 0x62, 0x34, 0x37, 0x31, 0x34, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+	0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+	0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69, 0x64, 0x3a, 0x66, 0x63, 0x39, 0x36, 0x32, 0x32,
+	0x62, 0x32, 0x2d, 0x64, 0x34, 0x37, 0x38, 0x2d, 0x36, 0x31, 0x34, 0x34, 0x2d, 0x62, 0x64, 0x30,
+	0x37, 0x2d, 0x33, 0x65, 0x62, 0x37, 0x39, 0x31, 0x62, 0x62, 0x34, 0x37, 0x31, 0x34, 0x22, 0x3e,
+	0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+	0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+	0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+	0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+	0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+	0x64, 0x3a, 0x66, 0x63, 0x39, 0x36, 0x32, 0x32, 0x62, 0x32, 0x2d, 0x64, 0x34, 0x37, 0x38, 0x2d,
+	0x36, 0x31, 0x34, 0x34, 0x2d, 0x62, 0x64, 0x30, 0x37, 0x2d, 0x33, 0x65, 0x62, 0x37, 0x39, 0x31,
+	0x62, 0x62, 0x34, 0x37, 0x31, 0x34, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+	0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x32, 0x31, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x35, 0x54, 0x32,
+	0x30, 0x3a, 0x35, 0x33, 0x3a, 0x30, 0x33, 0x2d, 0x30, 0x38, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+	0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+	0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+	0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x28, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29,
+	0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x3d,
+	0x22, 0x2f, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65, 0x71, 0x3e,
+	0x20, 0x3c, 0x2f, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
+	0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+	0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46, 0x3e, 0x20,
+	0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x3f, 0x78,
+	0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x77, 0x22, 0x3f, 0x3e,
+	0xff, 0xee, 0x00, 0x21, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x00, 0x64, 0x40, 0x00, 0x00, 0x00, 0x01,
+	0x03, 0x00, 0x10, 0x03, 0x02, 0x03, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x84, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xff, 0xc2, 0x00, 0x11, 0x08, 0x00, 0x2d,
+	0x00, 0x2d, 0x03, 0x01, 0x11, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x9c,
+	0x00, 0x00, 0x01, 0x04, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0a, 0x00, 0x01, 0x08, 0x09, 0x02, 0x04, 0x07, 0x06, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x05,
+	0x00, 0x09, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x06,
+	0x07, 0x08, 0x00, 0x10, 0x11, 0x21, 0x02, 0x04, 0x16, 0x09, 0x0a, 0x50, 0x03, 0x19, 0x1a, 0x13,
+	0x17, 0x18, 0x11, 0x00, 0x00, 0x05, 0x02, 0x04, 0x04, 0x03, 0x05, 0x06, 0x07, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x11, 0x06, 0x00, 0x12, 0x13, 0x07, 0x14, 0x15,
+	0x16, 0x17, 0x21, 0x41, 0x08, 0x31, 0x51, 0x61, 0x23, 0x18, 0x10, 0xf0, 0xa1, 0x22, 0x32, 0x26,
+	0x20, 0x81, 0x91, 0xb1, 0xe1, 0x24, 0x25, 0x36, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01,
+	0x01, 0x02, 0x11, 0x03, 0x11, 0x00, 0x00, 0x00, 0x3f, 0x82, 0xb5, 0x4a, 0x3b, 0x3b, 0x18, 0x44,
+	0xe7, 0x64, 0x2b, 0x5c, 0x04, 0x43, 0x48, 0x44, 0xd3, 0x0f, 0xdc, 0x13, 0x70, 0x7f, 0x44, 0x21,
+	0x82, 0xcc, 0x38, 0xc8, 0x33, 0x42, 0x11, 0x80, 0x72, 0xe4, 0xf9, 0x01, 0x08, 0x85, 0xe6, 0x21,
+	0x26, 0x85, 0x48, 0x39, 0xe6, 0x0a, 0x01, 0x26, 0x41, 0x6b, 0x83, 0x9f, 0xff, 0xda, 0x00, 0x08,
+	0x01, 0x02, 0x00, 0x01, 0x05, 0x00, 0xe8, 0x9f, 0xff, 0xda, 0x00, 0x08, 0x01, 0x03, 0x00, 0x01,
+	0x05, 0x00, 0xe8, 0x9f, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x01, 0x05, 0x00, 0xa4, 0xd7,
+	0xdd, 0x32, 0x35, 0x42, 0xac, 0xc2, 0xb3, 0x90, 0xf4, 0x96, 0xcf, 0x98, 0x33, 0x3c, 0x89, 0x8c,
+	0xc0, 0xdd, 0x89, 0x7f, 0xda, 0x19, 0x28, 0xde, 0xd3, 0x74, 0xb9, 0xaf, 0x98, 0x85, 0x31, 0xac,
+	0xd0, 0xd0, 0xd8, 0xf8, 0xda, 0xa8, 0x1b, 0x34, 0xd6, 0x50, 0x75, 0xf7, 0xd6, 0x29, 0x7d, 0x1d,
+	0xc8, 0x79, 0x5a, 0x63, 0x9f, 0x92, 0xf5, 0x88, 0x00, 0x87, 0xdb, 0x8a, 0x4f, 0x5e, 0x1e, 0x44,
+	0xec, 0xb9, 0xb6, 0x13, 0x3a, 0xf1, 0x8f, 0x76, 0xcf, 0xc5, 0xaa, 0x3f, 0x11, 0x2f, 0xf3, 0x16,
+	0xde, 0xc9, 0x36, 0x8a, 0x68, 0x40, 0xd7, 0xde, 0x0e, 0xac, 0x82, 0xcc, 0x40, 0x38, 0xc3, 0xe5,
+	0xda, 0x5b, 0x69, 0x85, 0xaf, 0x71, 0x6b, 0x65, 0xc3, 0x45, 0x9e, 0x8c, 0xd2, 0xce, 0xd7, 0xaf,
+	0x0e, 0xa1, 0x86, 0x3e, 0x21, 0xf5, 0x2d, 0xd4, 0xba, 0xcf, 0xff, 0xda, 0x00, 0x08, 0x01, 0x02,
+	0x02, 0x06, 0x3f, 0x00, 0x13, 0xff, 0xda, 0x00, 0x08, 0x01, 0x03, 0x02, 0x06, 0x3f, 0x00, 0x13,
+	0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x01, 0x06, 0x3f, 0x00, 0xc2, 0x96, 0x95, 0xc4, 0xf2, 0x53,
+	0x72, 0xf7, 0x84, 0xcd, 0x12, 0x76, 0x8e, 0xd3, 0x6d, 0xfa, 0x8c, 0x5c, 0xcc, 0xc7, 0x22, 0xe4,
+	0xa0, 0xa3, 0x37, 0x17, 0xa4, 0xcb, 0xb5, 0xd3, 0x87, 0xb2, 0xda, 0x3c, 0x47, 0xf3, 0xa4, 0x0e,
+	0x8c, 0x67, 0x8a, 0x90, 0x4a, 0x74, 0xdb, 0x9d, 0x33, 0x01, 0xf0, 0x75, 0x2c, 0x7d, 0x89, 0xd9,
+	0x2b, 0x5e, 0x24, 0x14, 0x3e, 0x8b, 0x5b, 0xa2, 0x46, 0xf8, 0xbc, 0xe4, 0xc5, 0x1c, 0xdf, 0x2c,
+	0x1c, 0x3e, 0x8c, 0x93, 0xb2, 0x9a, 0x15, 0x61, 0x20, 0x00, 0x9b, 0x23, 0x71, 0x28, 0x0f, 0x80,
+	0x09, 0xa9, 0x51, 0x64, 0xc3, 0xd4, 0x57, 0xa7, 0xb6, 0x49, 0xc0, 0xae, 0xa2, 0x29, 0x3d, 0xbb,
+	0x36, 0x66, 0x75, 0xe3, 0xa7, 0xd1, 0xa4, 0x39, 0x8a, 0x0b, 0x3c, 0x52, 0xc7, 0xbb, 0x8d, 0x9e,
+	0x41, 0x04, 0x89, 0x51, 0xc8, 0x84, 0xb0, 0xac, 0x3e, 0xc2, 0x90, 0x69, 0xe3, 0x19, 0xba, 0x3b,
+	0x2b, 0x7c, 0x44, 0x5f, 0x56, 0x74, 0xa1, 0x8c, 0x87, 0x1b, 0x1c, 0xa1, 0x93, 0x7b, 0x13, 0x24,
+	0x89, 0x4a, 0x2e, 0xe1, 0x2e, 0x08, 0x97, 0x04, 0x46, 0x4a, 0x02, 0x71, 0x88, 0x9c, 0x35, 0x5a,
+	0xba, 0x49, 0x25, 0x8a, 0x06, 0x29, 0x80, 0x04, 0x86, 0x21, 0x8d, 0x87, 0xb7, 0x1d, 0xa2, 0xa3,
+	0x33, 0x6f, 0x16, 0xe5, 0x49, 0x9a, 0xc0, 0xda, 0x44, 0x1e, 0x22, 0x9b, 0xb4, 0x23, 0xa6, 0xdc,
+	0xb1, 0x5d, 0xe4, 0xc5, 0xe6, 0xe9, 0x8a, 0xc0, 0x29, 0x3d, 0x67, 0x65, 0x43, 0xa2, 0x77, 0x40,
+	0x91, 0xc0, 0xc9, 0xaa, 0xf0, 0xcd, 0xd3, 0x39, 0x4c, 0x99, 0xcf, 0x89, 0x6b, 0x82, 0xe0, 0x96,
+	0x93, 0xb8, 0x2e, 0x09, 0xf9, 0x37, 0x93, 0x53, 0xf3, 0xf3, 0x4f, 0x16, 0x91, 0x99, 0x9c, 0x99,
+	0x91, 0x58, 0xce, 0x1f, 0xca, 0x4a, 0xc8, 0x38, 0x31, 0x97, 0x78, 0xf5, 0xda, 0xc6, 0x13, 0x1c,
+	0xe6, 0x1f, 0x80, 0x00, 0x14, 0x00, 0x03, 0xec, 0x86, 0xdc, 0x78, 0xa7, 0xaf, 0xdd, 0x6d, 0x9d,
+	0xc2, 0xee, 0x3e, 0x17, 0x7b, 0x2c, 0x94, 0xd5, 0x13, 0xc7, 0x5c, 0xb6, 0x59, 0x97, 0x04, 0x96,
+	0x9c, 0x41, 0x99, 0xcc, 0x54, 0x91, 0xbb, 0x2c, 0xe4, 0x95, 0x17, 0x91, 0xee, 0x89, 0x95, 0x53,
+	0x11, 0x33, 0xb6, 0x39, 0x8c, 0x8a, 0xc6, 0x2e, 0x3b, 0x81, 0xce, 0xd8, 0xf4, 0x5f, 0x4d, 0x75,
+	0x97, 0x51, 0xea, 0x8f, 0x2d, 0xe9, 0x7e, 0x59, 0xce, 0xf9, 0xde, 0xb6, 0x5a, 0xf0, 0x1c, 0xa7,
+	0xe7, 0xe6, 0xa5, 0x74, 0xfc, 0x69, 0x8d, 0x89, 0xb1, 0xd4, 0x55, 0x5e, 0x51, 0x6b, 0xec, 0x94,
+	0x85, 0xce, 0xcd, 0xb8, 0x98, 0xdc, 0x3f, 0x33, 0xbc, 0xef, 0x89, 0x48, 0xc9, 0x07, 0x20, 0x4f,
+	0xd1, 0xaf, 0xc2, 0x59, 0x4d, 0x89, 0x9b, 0xf5, 0x01, 0x6a, 0x1e, 0xc1, 0xfe, 0x0a, 0x18, 0x00,
+	0x40, 0xc0, 0x25, 0x10, 0x1a, 0x08, 0x08, 0x18, 0x28, 0x20, 0x20, 0x3e, 0xd0, 0x10, 0xf2, 0xc7,
+	0x55, 0x71, 0x4f, 0xb9, 0xbf, 0x63, 0xfb, 0x47, 0xc7, 0x6b, 0x29, 0xc5, 0xf2, 0x3e, 0xeb, 0xf6,
+	0x67, 0x57, 0x5f, 0x36, 0xad, 0x3a, 0x5f, 0xf2, 0x66, 0xad, 0x72, 0xf9, 0xe3, 0xd3, 0xdf, 0xa8,
+	0xc6, 0x0c, 0xd4, 0x5e, 0x05, 0x36, 0x73, 0x9b, 0x2f, 0x76, 0x3c, 0x49, 0x23, 0x98, 0x91, 0x8f,
+	0xdd, 0x3b, 0x3d, 0xdd, 0x63, 0x2a, 0xed, 0x50, 0x0c, 0x89, 0xa1, 0x22, 0x70, 0x97, 0x6e, 0x51,
+	0x1f, 0x11, 0x5b, 0x4c, 0xbe, 0x78, 0xaf, 0xbf, 0xed, 0x02, 0xb7, 0x6e, 0xb3, 0xb7, 0x2a, 0x1d,
+	0x34, 0x1a, 0xb3, 0x6c, 0x41, 0x51, 0xcb, 0xd7, 0x6e, 0x0e, 0x54, 0x5a, 0x32, 0x6c, 0x99, 0x40,
+	0x4c, 0xa3, 0x97, 0x8e, 0x4e, 0x54, 0xd3, 0x28, 0x78, 0x98, 0xe6, 0x00, 0xf3, 0xc7, 0xd1, 0xf7,
+	0x0c, 0x4e, 0xe2, 0x7d, 0x39, 0x69, 0x70, 0x7a, 0x46, 0xcb, 0xdd, 0x8a, 0x77, 0x17, 0x97, 0xe4,
+	0xa6, 0x7f, 0xfd, 0xf7, 0xfa, 0xfe, 0xfa, 0x62, 0xf8, 0xd9, 0x5d, 0xd1, 0x8c, 0x3c, 0x9d, 0x99,
+	0x7d, 0xc4, 0x29, 0x1a, 0xff, 0x00, 0x87, 0x39, 0x50, 0x93, 0x8b, 0x76, 0x43, 0xa6, 0xe6, 0x2a,
+	0x7e, 0x11, 0xe9, 0x93, 0x57, 0x80, 0x9c, 0x81, 0x92, 0x41, 0x27, 0x4d, 0x16, 0xca, 0x60, 0x22,
+	0xc9, 0x17, 0x31, 0x4c, 0x41, 0x31, 0x45, 0xe4, 0x4e, 0xe4, 0xc3, 0x3b, 0x9e, 0xdb, 0x57, 0x4f,
+	0x96, 0x25, 0x91, 0xbd, 0x70, 0xb1, 0xeb, 0x1a, 0xcb, 0xb9, 0xa3, 0x4c, 0xa1, 0x85, 0x9a, 0x53,
+	0x6b, 0xa0, 0x0a, 0xa5, 0x67, 0x5d, 0x69, 0x20, 0x19, 0x5d, 0x47, 0xbc, 0x14, 0xca, 0x2a, 0x14,
+	0x4e, 0xd8, 0xea, 0xa2, 0x62, 0x9b, 0x19, 0x80, 0x40, 0x4a, 0x21, 0x50, 0x30, 0x0d, 0x4a, 0x60,
+	0x1a, 0x50, 0x4a, 0x21, 0x50, 0x10, 0x1a, 0xff, 0x00, 0x4c, 0x20, 0x81, 0x40, 0xea, 0xb8, 0x76,
+	0xb1, 0x1b, 0x33, 0x6a, 0x82, 0x6a, 0x38, 0x76, 0xf5, 0xd2, 0x83, 0x44, 0x9a, 0xb3, 0x68, 0x89,
+	0x4e, 0xe5, 0xdb, 0xa5, 0x47, 0xc0, 0xa9, 0xa6, 0x53, 0x1c, 0xc3, 0xec, 0x0c, 0x5a, 0xbe, 0xaa,
+	0x3d, 0x53, 0xda, 0x8e, 0xad, 0x58, 0x1b, 0x59, 0xc3, 0x5b, 0x8b, 0x67, 0xf6, 0x8a, 0xe1, 0x6c,
+	0x08, 0x5c, 0x53, 0x57, 0x1a, 0x06, 0x05, 0x62, 0xaf, 0xdb, 0xfa, 0x21, 0x62, 0x99, 0x58, 0x58,
+	0x98, 0x53, 0xd1, 0xc4, 0x5c, 0x5a, 0xf9, 0x1d, 0x2e, 0xec, 0xa9, 0xb9, 0x70, 0x42, 0x26, 0x9a,
+	0x69, 0xad, 0xfc, 0xeb, 0xf8, 0xd7, 0x1e, 0x3f, 0x7f, 0xf3, 0x89, 0xbe, 0xe1, 0xf4, 0xc7, 0x45,
+	0x70, 0x47, 0xea, 0x3e, 0xb3, 0xe5, 0x5d, 0x2d, 0xcb, 0xb3, 0x93, 0x53, 0x9d, 0xf3, 0xcf, 0xf9,
+	0x3c, 0x16, 0x7c, 0xb5, 0xd7, 0xf9, 0x75, 0xa7, 0xc3, 0x0e, 0xfa, 0xa7, 0xb2, 0x1c, 0xdf, 0x8d,
+	0x57, 0x8e, 0xed, 0x2f, 0x76, 0x39, 0x47, 0x17, 0x9f, 0xe7, 0x6a, 0x76, 0x77, 0xf6, 0xd5, 0x75,
+	0x2b, 0x9f, 0x27, 0x86, 0x6a, 0xd7, 0x0d, 0xbe, 0x90, 0x3e, 0x9c, 0x7b, 0x89, 0x95, 0x2e, 0x0b,
+	0x46, 0x9d, 0xd4, 0xae, 0x72, 0x69, 0x72, 0xfe, 0xe2, 0xfe, 0xfb, 0xd4, 0xd5, 0xa5, 0x34, 0x3c,
+	0x6b, 0x5a, 0x79, 0xe3, 0xef, 0xee, 0xfe, 0xf4, 0xc7, 0xc3, 0xf0, 0xa6, 0x3f, 0xff, 0xd9,
+};
+
+unsigned char const hud_stay_jpg[] = {
+	0xff, 0xd8, 0xff, 0xe1, 0x05, 0xe2, 0x45, 0x78, 0x69, 0x66, 0x00, 0x00, 0x4d, 0x4d, 0x00, 0x2a,
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x01, 0x12, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x1a, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x62, 0x01, 0x1b,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6a, 0x01, 0x28, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x01, 0x31, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00,
+	0x00, 0x72, 0x01, 0x32, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x8f, 0x87, 0x69,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x0a,
+	0xfc, 0x80, 0x00, 0x00, 0x27, 0x10, 0x00, 0x0a, 0xfc, 0x80, 0x00, 0x00, 0x27, 0x10, 0x41, 0x64,
+	0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+	0x20, 0x28, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x00, 0x32, 0x30, 0x32, 0x31, 0x3a,
+	0x31, 0x32, 0x3a, 0x30, 0x35, 0x20, 0x32, 0x30, 0x3a, 0x35, 0x33, 0x3a, 0x30, 0x35, 0x00, 0x00,
+	0x00, 0x03, 0xa0, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00, 0xa0, 0x02,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2d, 0xa0, 0x03, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x03,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x01, 0x1a, 0x00, 0x05, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x1b, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x26, 0x01, 0x28, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x2e, 0x02, 0x02, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x04, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x01, 0xff, 0xd8, 0xff, 0xed, 0x00, 0x0c,
+	0x41, 0x64, 0x6f, 0x62, 0x65, 0x5f, 0x43, 0x4d, 0x00, 0x02, 0xff, 0xee, 0x00, 0x0e, 0x41, 0x64,
+	0x6f, 0x62, 0x65, 0x00, 0x64, 0x80, 0x00, 0x00, 0x00, 0x01, 0xff, 0xdb, 0x00, 0x84, 0x00, 0x0c,
+	0x08, 0x08, 0x08, 0x09, 0x08, 0x0c, 0x09, 0x09, 0x0c, 0x11, 0x0b, 0x0a, 0x0b, 0x11, 0x15, 0x0f,
+	0x0c, 0x0c, 0x0f, 0x15, 0x18, 0x13, 0x13, 0x15, 0x13, 0x13, 0x18, 0x11, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x01,
+	0x0d, 0x0b, 0x0b, 0x0d, 0x0e, 0x0d, 0x10, 0x0e, 0x0e, 0x10, 0x14, 0x0e, 0x0e, 0x0e, 0x14, 0x14,
+	0x0e, 0x0e, 0x0e, 0x0e, 0x14, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x11, 0x11, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x2d, 0x00, 0x2d, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01,
+	0x03, 0x11, 0x01, 0xff, 0xdd, 0x00, 0x04, 0x00, 0x03, 0xff, 0xc4, 0x01, 0x3f, 0x00, 0x00, 0x01,
+	0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x01, 0x00, 0x01, 0x05, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x03, 0x04,
+	0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x10, 0x00, 0x01, 0x04, 0x01, 0x03, 0x02, 0x04, 0x02,
+	0x05, 0x07, 0x06, 0x08, 0x05, 0x03, 0x0c, 0x33, 0x01, 0x00, 0x02, 0x11, 0x03, 0x04, 0x21, 0x12,
+	0x31, 0x05, 0x41, 0x51, 0x61, 0x13, 0x22, 0x71, 0x81, 0x32, 0x06, 0x14, 0x91, 0xa1, 0xb1, 0x42,
+	0x23, 0x24, 0x15, 0x52, 0xc1, 0x62, 0x33, 0x34, 0x72, 0x82, 0xd1, 0x43, 0x07, 0x25, 0x92, 0x53,
+	0xf0, 0xe1, 0xf1, 0x63, 0x73, 0x35, 0x16, 0xa2, 0xb2, 0x83, 0x26, 0x44, 0x93, 0x54, 0x64, 0x45,
+	0xc2, 0xa3, 0x74, 0x36, 0x17, 0xd2, 0x55, 0xe2, 0x65, 0xf2, 0xb3, 0x84, 0xc3, 0xd3, 0x75, 0xe3,
+	0xf3, 0x46, 0x27, 0x94, 0xa4, 0x85, 0xb4, 0x95, 0xc4, 0xd4, 0xe4, 0xf4, 0xa5, 0xb5, 0xc5, 0xd5,
+	0xe5, 0xf5, 0x56, 0x66, 0x76, 0x86, 0x96, 0xa6, 0xb6, 0xc6, 0xd6, 0xe6, 0xf6, 0x37, 0x47, 0x57,
+	0x67, 0x77, 0x87, 0x97, 0xa7, 0xb7, 0xc7, 0xd7, 0xe7, 0xf7, 0x11, 0x00, 0x02, 0x02, 0x01, 0x02,
+	0x04, 0x04, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x06, 0x05, 0x35, 0x01, 0x00, 0x02, 0x11, 0x03,
+	0x21, 0x31, 0x12, 0x04, 0x41, 0x51, 0x61, 0x71, 0x22, 0x13, 0x05, 0x32, 0x81, 0x91, 0x14, 0xa1,
+	0xb1, 0x42, 0x23, 0xc1, 0x52, 0xd1, 0xf0, 0x33, 0x24, 0x62, 0xe1, 0x72, 0x82, 0x92, 0x43, 0x53,
+	0x15, 0x63, 0x73, 0x34, 0xf1, 0x25, 0x06, 0x16, 0xa2, 0xb2, 0x83, 0x07, 0x26, 0x35, 0xc2, 0xd2,
+	0x44, 0x93, 0x54, 0xa3, 0x17, 0x64, 0x45, 0x55, 0x36, 0x74, 0x65, 0xe2, 0xf2, 0xb3, 0x84, 0xc3,
+	0xd3, 0x75, 0xe3, 0xf3, 0x46, 0x94, 0xa4, 0x85, 0xb4, 0x95, 0xc4, 0xd4, 0xe4, 0xf4, 0xa5, 0xb5,
+	0xc5, 0xd5, 0xe5, 0xf5, 0x56, 0x66, 0x76, 0x86, 0x96, 0xa6, 0xb6, 0xc6, 0xd6, 0xe6, 0xf6, 0x27,
+	0x37, 0x47, 0x57, 0x67, 0x77, 0x87, 0x97, 0xa7, 0xb7, 0xc7, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01,
+	0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xf5, 0x55, 0x89, 0xd7, 0x7e, 0xb6, 0xf4, 0xae,
+	0x8a, 0x7d, 0x2b, 0x49, 0xbf, 0x2a, 0x27, 0xec, 0xf5, 0xc4, 0x8f, 0xf8, 0xc7, 0x7d, 0x1a, 0xd2,
+	0xfa, 0xdb, 0xd7, 0x8f, 0x45, 0xe9, 0x66, 0xda, 0xa3, 0xed, 0x57, 0x9f, 0x4f, 0x1e, 0x75, 0x83,
+	0x1e, 0xeb, 0x7f, 0xeb, 0x6d, 0x5e, 0x49, 0x65, 0x96, 0x5b, 0x63, 0xac, 0xb1, 0xc5, 0xef, 0x79,
+	0x2e, 0x73, 0x9c, 0x64, 0x92, 0x79, 0x24, 0xaa, 0xdc, 0xc7, 0x31, 0xed, 0xfa, 0x63, 0xf3, 0x7f,
+	0xd1, 0x77, 0x3e, 0x0d, 0xf0, 0x61, 0xcd, 0x83, 0x9f, 0x39, 0x23, 0x08, 0x3c, 0x31, 0x8c, 0x74,
+	0x96, 0x59, 0x0f, 0x9b, 0xd5, 0xfb, 0x8f, 0x61, 0x7f, 0xf8, 0xcc, 0xea, 0x8e, 0x77, 0xe8, 0x31,
+	0x68, 0xad, 0xbe, 0x0f, 0xdc, 0xf3, 0xf7, 0xb5, 0xd5, 0x2b, 0x38, 0x1f, 0xe3, 0x34, 0x97, 0x86,
+	0xf5, 0x1c, 0x40, 0x18, 0x79, 0xb2, 0x83, 0xa8, 0xff, 0x00, 0xad, 0x59, 0xff, 0x00, 0xa5, 0x17,
+	0x08, 0x92, 0xa8, 0x39, 0x9c, 0xa0, 0xdf, 0x13, 0xd0, 0x4b, 0xe0, 0x9f, 0x0f, 0x94, 0x78, 0x7d,
+	0x80, 0x3c, 0x62, 0x65, 0xc7, 0xfe, 0x37, 0x13, 0xed, 0xfd, 0x3f, 0xa8, 0xe1, 0x75, 0x2c, 0x66,
+	0xe5, 0x61, 0x5a, 0x2d, 0xa9, 0xdd, 0xc7, 0x20, 0xfe, 0xeb, 0xdb, 0xf4, 0x98, 0xe5, 0x65, 0x78,
+	0xef, 0xd5, 0xbe, 0xbd, 0x7f, 0x44, 0xea, 0x0c, 0xbd, 0xa4, 0x9c, 0x77, 0x90, 0xdc, 0x9a, 0xbb,
+	0x39, 0x9e, 0x3f, 0xf1, 0x8c, 0xfa, 0x4c, 0x5e, 0xbd, 0xeb, 0xd3, 0xe8, 0x7d, 0xa3, 0x78, 0xf4,
+	0x76, 0xfa, 0x9b, 0xfb, 0x6d, 0x8d, 0xfb, 0xff, 0x00, 0xcd, 0x57, 0x31, 0xf3, 0x1c, 0x78, 0xe5,
+	0x2a, 0xa9, 0x40, 0x12, 0x43, 0xcd, 0xf3, 0x7f, 0x07, 0xfb, 0xbf, 0x3b, 0x83, 0x09, 0x91, 0x96,
+	0x0e, 0x63, 0x24, 0x61, 0x09, 0xfe, 0x9d, 0x4a, 0x71, 0x84, 0xe2, 0x7f, 0xaf, 0x1e, 0x27, 0xff,
+	0xd0, 0xbf, 0xfe, 0x33, 0x2f, 0x73, 0xba, 0xa6, 0x2d, 0x1f, 0x9b, 0x5d, 0x1b, 0xc7, 0xc5, 0xee,
+	0x73, 0x5d, 0xff, 0x00, 0x9e, 0x97, 0x1a, 0xbb, 0xbf, 0xf1, 0x9b, 0x80, 0xfd, 0xd8, 0x9d, 0x45,
+	0xa2, 0x58, 0x01, 0xa2, 0xc3, 0xe0, 0x7f, 0x9c, 0xab, 0xff, 0x00, 0x46, 0x2e, 0x11, 0x65, 0xf3,
+	0x20, 0x8c, 0xd2, 0xb7, 0xbc, 0xf8, 0x24, 0xa3, 0x2f, 0x87, 0xe0, 0xe1, 0xe8, 0x0c, 0x4f, 0xf7,
+	0xf8, 0xa5, 0xc4, 0xa4, 0x92, 0x49, 0x42, 0xe9, 0x29, 0x7a, 0x2f, 0xdb, 0x6d, 0xff, 0x00, 0xc6,
+	0xd7, 0xd6, 0xd7, 0x77, 0xa3, 0xe8, 0x4f, 0xf2, 0x7d, 0x5f, 0xb3, 0x7f, 0xe7, 0xb5, 0xe7, 0x60,
+	0x12, 0x60, 0x6a, 0x4f, 0x00, 0x2f, 0x57, 0xfd, 0x87, 0x67, 0xfc, 0xcc, 0xfd, 0x91, 0x1f, 0xa7,
+	0xfb, 0x37, 0xd1, 0xff, 0x00, 0x85, 0xfe, 0x7f, 0x6f, 0xfd, 0xbc, 0xa7, 0xe5, 0xc1, 0xac, 0xa7,
+	0xa7, 0xb7, 0x27, 0x27, 0xe3, 0x12, 0x8f, 0xb9, 0xc8, 0x44, 0xfc, 0xe7, 0x9b, 0xc5, 0x28, 0xff,
+	0x00, 0x76, 0x27, 0xd7, 0xff, 0x00, 0x4a, 0x0f, 0xff, 0xd1, 0xf4, 0xce, 0xa3, 0xd3, 0xf1, 0xba,
+	0x96, 0x15, 0xb8, 0x59, 0x4d, 0xdd, 0x55, 0xc2, 0x0c, 0x72, 0x0f, 0xe6, 0xbd, 0xbf, 0xcb, 0x63,
+	0x97, 0x93, 0x75, 0xef, 0xab, 0x7d, 0x43, 0xa2, 0x5e, 0x5b, 0x7b, 0x0b, 0xf1, 0xc9, 0xfd, 0x16,
+	0x43, 0x47, 0xb1, 0xc3, 0xf9, 0x5f, 0xb9, 0x67, 0xf2, 0x17, 0xb1, 0x21, 0xdf, 0xe8, 0x7a, 0x2e,
+	0xfb, 0x46, 0xcf, 0x46, 0x3d, 0xfe, 0xa4, 0x6d, 0x8f, 0xe5, 0x6f, 0xf6, 0xaa, 0xfc, 0xc6, 0x3c,
+	0x73, 0xae, 0x29, 0x08, 0x48, 0x6c, 0x49, 0x76, 0x3e, 0x0f, 0xcd, 0xf3, 0xbc, 0xbf, 0x11, 0xc3,
+	0x83, 0x27, 0x31, 0x82, 0x47, 0xd7, 0x08, 0x46, 0x72, 0x1c, 0x7f, 0xd5, 0x9c, 0x23, 0x2e, 0x19,
+	0xbe, 0x16, 0x9c, 0x02, 0x48, 0x03, 0x52, 0x78, 0x01, 0x7a, 0x26, 0x6f, 0xfe, 0x36, 0xbe, 0xa1,
+	0xf5, 0xbd, 0x1d, 0xdd, 0xfd, 0x0f, 0x53, 0x6f, 0xfe, 0xcb, 0x7e, 0x8d, 0x69, 0xf4, 0x3f, 0xf9,
+	0x99, 0xea, 0x0f, 0xd9, 0x1f, 0x66, 0xf5, 0xff, 0x00, 0x37, 0xfd, 0x2f, 0xf6, 0x7d, 0x7f, 0xd2,
+	0xaa, 0x83, 0x97, 0x17, 0xae, 0x5c, 0x75, 0xfd, 0xe7, 0xa0, 0x97, 0xc6, 0x32, 0x70, 0xdc, 0x79,
+	0x0e, 0x6c, 0xcf, 0xf7, 0x65, 0x88, 0xc6, 0x3f, 0xe3, 0xfa, 0xbf, 0xe8, 0x38, 0x1f, 0x53, 0x3e,
+	0xa6, 0xde, 0x2f, 0xaf, 0xaa, 0x75, 0x4a, 0xcd, 0x6c, 0xae, 0x1f, 0x8f, 0x8e, 0xef, 0xa4, 0x5d,
+	0xf9, 0xb6, 0xda, 0xdf, 0xcd, 0x6b, 0x7f, 0x31, 0x8b, 0xbf, 0x49, 0x25, 0x72, 0x10, 0xc4, 0x31,
+	0x4a, 0x31, 0x90, 0x20, 0x83, 0xc5, 0x2b, 0x79, 0xbe, 0x6b, 0x9a, 0xe7, 0x67, 0xce, 0xe1, 0xcf,
+	0x9f, 0x0c, 0xe3, 0x92, 0x33, 0x84, 0xb0, 0x60, 0x94, 0x27, 0x0f, 0x92, 0x77, 0x18, 0x42, 0x32,
+	0xf5, 0x4b, 0x8a, 0x4f, 0xff, 0xd9, 0xff, 0xed, 0x0d, 0xc8, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+	0x68, 0x6f, 0x70, 0x20, 0x33, 0x2e, 0x30, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x1c, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4d,
+	0x04, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xe8, 0xf1, 0x5c, 0xf3, 0x2f, 0xc1, 0x18, 0xa1,
+	0xa2, 0x7b, 0x67, 0xad, 0xc5, 0x64, 0xd5, 0xba, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x3a, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0b, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x50, 0x73, 0x74, 0x53, 0x62, 0x6f, 0x6f, 0x6c, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x49, 0x6e, 0x74, 0x65, 0x65, 0x6e, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x49, 0x6e,
+	0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x43, 0x6c, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x0f, 0x70, 0x72,
+	0x69, 0x6e, 0x74, 0x53, 0x69, 0x78, 0x74, 0x65, 0x65, 0x6e, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x6f,
+	0x6c, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x4e, 0x61, 0x6d,
+	0x65, 0x54, 0x45, 0x58, 0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x70,
+	0x72, 0x69, 0x6e, 0x74, 0x50, 0x72, 0x6f, 0x6f, 0x66, 0x53, 0x65, 0x74, 0x75, 0x70, 0x4f, 0x62,
+	0x6a, 0x63, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x50, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x66,
+	0x00, 0x20, 0x00, 0x53, 0x00, 0x65, 0x00, 0x74, 0x00, 0x75, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0a, 0x70, 0x72, 0x6f, 0x6f, 0x66, 0x53, 0x65, 0x74, 0x75, 0x70, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x42, 0x6c, 0x74, 0x6e, 0x65, 0x6e, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x0c,
+	0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x50, 0x72, 0x6f, 0x6f, 0x66, 0x00, 0x00, 0x00, 0x09,
+	0x70, 0x72, 0x6f, 0x6f, 0x66, 0x43, 0x4d, 0x59, 0x4b, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x3b,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x2d, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x4f,
+	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x43, 0x70,
+	0x74, 0x6e, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x6c, 0x62, 0x72, 0x62,
+	0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x67, 0x73, 0x4d, 0x62, 0x6f, 0x6f, 0x6c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x72, 0x6e, 0x43, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x43, 0x6e, 0x74, 0x43, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c,
+	0x62, 0x6c, 0x73, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x67, 0x74, 0x76,
+	0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x6d, 0x6c, 0x44, 0x62, 0x6f, 0x6f,
+	0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x74, 0x72, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x42, 0x63, 0x6b, 0x67, 0x4f, 0x62, 0x6a, 0x63, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x47, 0x42, 0x43, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x52, 0x64, 0x20, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x40, 0x6f, 0xe0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x72, 0x6e, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x40, 0x6f, 0xe0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x6c, 0x20, 0x20, 0x64, 0x6f, 0x75,
+	0x62, 0x40, 0x6f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x72, 0x64,
+	0x54, 0x55, 0x6e, 0x74, 0x46, 0x23, 0x52, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x6c, 0x64, 0x20, 0x55, 0x6e, 0x74, 0x46, 0x23, 0x52, 0x6c,
+	0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x73, 0x6c,
+	0x74, 0x55, 0x6e, 0x74, 0x46, 0x23, 0x50, 0x78, 0x6c, 0x40, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0a, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x44, 0x61, 0x74, 0x61, 0x62,
+	0x6f, 0x6f, 0x6c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x50, 0x67, 0x50, 0x73, 0x65, 0x6e, 0x75, 0x6d,
+	0x00, 0x00, 0x00, 0x00, 0x50, 0x67, 0x50, 0x73, 0x00, 0x00, 0x00, 0x00, 0x50, 0x67, 0x50, 0x43,
+	0x00, 0x00, 0x00, 0x00, 0x4c, 0x65, 0x66, 0x74, 0x55, 0x6e, 0x74, 0x46, 0x23, 0x52, 0x6c, 0x74,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x6f, 0x70, 0x20,
+	0x55, 0x6e, 0x74, 0x46, 0x23, 0x52, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x53, 0x63, 0x6c, 0x20, 0x55, 0x6e, 0x74, 0x46, 0x23, 0x50, 0x72, 0x63,
+	0x40, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x63, 0x72, 0x6f, 0x70,
+	0x57, 0x68, 0x65, 0x6e, 0x50, 0x72, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x62, 0x6f, 0x6f, 0x6c,
+	0x00, 0x00, 0x00, 0x00, 0x0e, 0x63, 0x72, 0x6f, 0x70, 0x52, 0x65, 0x63, 0x74, 0x42, 0x6f, 0x74,
+	0x74, 0x6f, 0x6d, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63,
+	0x72, 0x6f, 0x70, 0x52, 0x65, 0x63, 0x74, 0x4c, 0x65, 0x66, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x63, 0x72, 0x6f, 0x70, 0x52, 0x65, 0x63, 0x74, 0x52,
+	0x69, 0x67, 0x68, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+	0x63, 0x72, 0x6f, 0x70, 0x52, 0x65, 0x63, 0x74, 0x54, 0x6f, 0x70, 0x6c, 0x6f, 0x6e, 0x67, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x03, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x00, 0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
+	0x38, 0x42, 0x49, 0x4d, 0x04, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x03, 0xf2,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x38, 0x42, 0x49, 0x4d, 0x04, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x5a,
+	0x38, 0x42, 0x49, 0x4d, 0x04, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1e,
+	0x38, 0x42, 0x49, 0x4d, 0x03, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x27, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x38, 0x42, 0x49, 0x4d,
+	0x03, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x2f, 0x66, 0x66, 0x00, 0x01, 0x00, 0x6c,
+	0x66, 0x66, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2f, 0x66, 0x66, 0x00, 0x01,
+	0x00, 0xa1, 0x99, 0x9a, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x32, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x35,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x38, 0x42, 0x49, 0x4d, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x03, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x03, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xe8, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xe8, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4d,
+	0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x40,
+	0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x1e, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x1a, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x3d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x73, 0x00, 0x74,
+	0x00, 0x61, 0x00, 0x79, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x73, 0x4f, 0x62, 0x6a,
+	0x63, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x63, 0x74, 0x31, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x6f, 0x70, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x65, 0x66, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x74, 0x6f, 0x6d, 0x6c, 0x6f, 0x6e, 0x67, 0x00,
+	0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x52, 0x67, 0x68, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00,
+	0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x06, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x73, 0x56, 0x6c, 0x4c,
+	0x73, 0x00, 0x00, 0x00, 0x01, 0x4f, 0x62, 0x6a, 0x63, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x07,
+	0x73, 0x6c, 0x69, 0x63, 0x65, 0x49, 0x44, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x49, 0x44, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x65, 0x6e, 0x75, 0x6d,
+	0x00, 0x00, 0x00, 0x0c, 0x45, 0x53, 0x6c, 0x69, 0x63, 0x65, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e,
+	0x00, 0x00, 0x00, 0x0d, 0x61, 0x75, 0x74, 0x6f, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65,
+	0x64, 0x00, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x65, 0x6e, 0x75, 0x6d, 0x00, 0x00, 0x00,
+	0x0a, 0x45, 0x53, 0x6c, 0x69, 0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x49,
+	0x6d, 0x67, 0x20, 0x00, 0x00, 0x00, 0x06, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x73, 0x4f, 0x62, 0x6a,
+	0x63, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x63, 0x74, 0x31, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x6f, 0x70, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x65, 0x66, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x74, 0x6f, 0x6d, 0x6c, 0x6f, 0x6e, 0x67, 0x00,
+	0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x52, 0x67, 0x68, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00,
+	0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x03, 0x75, 0x72, 0x6c, 0x54, 0x45, 0x58, 0x54, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x54, 0x45, 0x58, 0x54,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x73, 0x67, 0x65, 0x54, 0x45,
+	0x58, 0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x61, 0x6c, 0x74, 0x54,
+	0x61, 0x67, 0x54, 0x45, 0x58, 0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+	0x63, 0x65, 0x6c, 0x6c, 0x54, 0x65, 0x78, 0x74, 0x49, 0x73, 0x48, 0x54, 0x4d, 0x4c, 0x62, 0x6f,
+	0x6f, 0x6c, 0x01, 0x00, 0x00, 0x00, 0x08, 0x63, 0x65, 0x6c, 0x6c, 0x54, 0x65, 0x78, 0x74, 0x54,
+	0x45, 0x58, 0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x68, 0x6f, 0x72,
+	0x7a, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x65, 0x6e, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x0f, 0x45, 0x53,
+	0x6c, 0x69, 0x63, 0x65, 0x48, 0x6f, 0x72, 0x7a, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x00, 0x00, 0x00,
+	0x07, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x09, 0x76, 0x65, 0x72, 0x74,
+	0x41, 0x6c, 0x69, 0x67, 0x6e, 0x65, 0x6e, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x0f, 0x45, 0x53, 0x6c,
+	0x69, 0x63, 0x65, 0x56, 0x65, 0x72, 0x74, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x00, 0x00, 0x00, 0x07,
+	0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x0b, 0x62, 0x67, 0x43, 0x6f, 0x6c,
+	0x6f, 0x72, 0x54, 0x79, 0x70, 0x65, 0x65, 0x6e, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x11, 0x45, 0x53,
+	0x6c, 0x69, 0x63, 0x65, 0x42, 0x47, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x54, 0x79, 0x70, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x4e, 0x6f, 0x6e, 0x65, 0x00, 0x00, 0x00, 0x09, 0x74, 0x6f, 0x70, 0x4f, 0x75,
+	0x74, 0x73, 0x65, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+	0x6c, 0x65, 0x66, 0x74, 0x4f, 0x75, 0x74, 0x73, 0x65, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x4f, 0x75, 0x74, 0x73,
+	0x65, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x72, 0x69,
+	0x67, 0x68, 0x74, 0x4f, 0x75, 0x74, 0x73, 0x65, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+	0x00, 0x02, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x11,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x14, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d,
+	0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x17, 0xe8, 0x00, 0x00, 0x04, 0xac, 0x00, 0x18, 0x00, 0x01,
+	0xff, 0xd8, 0xff, 0xed, 0x00, 0x0c, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x5f, 0x43, 0x4d, 0x00, 0x02,
+	0xff, 0xee, 0x00, 0x0e, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x00, 0x64, 0x80, 0x00, 0x00, 0x00, 0x01,
+	0xff, 0xdb, 0x00, 0x84, 0x00, 0x0c, 0x08, 0x08, 0x08, 0x09, 0x08, 0x0c, 0x09, 0x09, 0x0c, 0x11,
+	0x0b, 0x0a, 0x0b, 0x11, 0x15, 0x0f, 0x0c, 0x0c, 0x0f, 0x15, 0x18, 0x13, 0x13, 0x15, 0x13, 0x13,
+	0x18, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x01, 0x0d, 0x0b, 0x0b, 0x0d, 0x0e, 0x0d, 0x10, 0x0e, 0x0e, 0x10,
+	0x14, 0x0e, 0x0e, 0x0e, 0x14, 0x14, 0x0e, 0x0e, 0x0e, 0x0e, 0x14, 0x11, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x11, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x2d, 0x00, 0x2d, 0x03,
+	0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xdd, 0x00, 0x04, 0x00, 0x03, 0xff,
+	0xc4, 0x01, 0x3f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+	0x01, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x10, 0x00, 0x01,
+	0x04, 0x01, 0x03, 0x02, 0x04, 0x02, 0x05, 0x07, 0x06, 0x08, 0x05, 0x03, 0x0c, 0x33, 0x01, 0x00,
+	0x02, 0x11, 0x03, 0x04, 0x21, 0x12, 0x31, 0x05, 0x41, 0x51, 0x61, 0x13, 0x22, 0x71, 0x81, 0x32,
+	0x06, 0x14, 0x91, 0xa1, 0xb1, 0x42, 0x23, 0x24, 0x15, 0x52, 0xc1, 0x62, 0x33, 0x34, 0x72, 0x82,
+	0xd1, 0x43, 0x07, 0x25, 0x92, 0x53, 0xf0, 0xe1, 0xf1, 0x63, 0x73, 0x35, 0x16, 0xa2, 0xb2, 0x83,
+	0x26, 0x44, 0x93, 0x54, 0x64, 0x45, 0xc2, 0xa3, 0x74, 0x36, 0x17, 0xd2, 0x55, 0xe2, 0x65, 0xf2,
+	0xb3, 0x84, 0xc3, 0xd3, 0x75, 0xe3, 0xf3, 0x46, 0x27, 0x94, 0xa4, 0x85, 0xb4, 0x95, 0xc4, 0xd4,
+	0xe4, 0xf4, 0xa5, 0xb5, 0xc5, 0xd5, 0xe5, 0xf5, 0x56, 0x66, 0x76, 0x86, 0x96, 0xa6, 0xb6, 0xc6,
+	0xd6, 0xe6, 0xf6, 0x37, 0x47, 0x57, 0x67, 0x77, 0x87, 0x97, 0xa7, 0xb7, 0xc7, 0xd7, 0xe7, 0xf7,
+	0x11, 0x00, 0x02, 0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x06, 0x05,
+	0x35, 0x01, 0x00, 0x02, 0x11, 0x03, 0x21, 0x31, 0x12, 0x04, 0x41, 0x51, 0x61, 0x71, 0x22, 0x13,
+	0x05, 0x32, 0x81, 0x91, 0x14, 0xa1, 0xb1, 0x42, 0x23, 0xc1, 0x52, 0xd1, 0xf0, 0x33, 0x24, 0x62,
+	0xe1, 0x72, 0x82, 0x92, 0x43, 0x53, 0x15, 0x63, 0x73, 0x34, 0xf1, 0x25, 0x06, 0x16, 0xa2, 0xb2,
+	0x83, 0x07, 0x26, 0x35, 0xc2, 0xd2, 0x44, 0x93, 0x54, 0xa3, 0x17, 0x64, 0x45, 0x55, 0x36, 0x74,
+	0x65, 0xe2, 0xf2, 0xb3, 0x84, 0xc3, 0xd3, 0x75, 0xe3, 0xf3, 0x46, 0x94, 0xa4, 0x85, 0xb4, 0x95,
+	0xc4, 0xd4, 0xe4, 0xf4, 0xa5, 0xb5, 0xc5, 0xd5, 0xe5, 0xf5, 0x56, 0x66, 0x76, 0x86, 0x96, 0xa6,
+	0xb6, 0xc6, 0xd6, 0xe6, 0xf6, 0x27, 0x37, 0x47, 0x57, 0x67, 0x77, 0x87, 0x97, 0xa7, 0xb7, 0xc7,
+	0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xf5, 0x55,
+	0x89, 0xd7, 0x7e, 0xb6, 0xf4, 0xae, 0x8a, 0x7d, 0x2b, 0x49, 0xbf, 0x2a, 0x27, 0xec, 0xf5, 0xc4,
+	0x8f, 0xf8, 0xc7, 0x7d, 0x1a, 0xd2, 0xfa, 0xdb, 0xd7, 0x8f, 0x45, 0xe9, 0x66, 0xda, 0xa3, 0xed,
+	0x57, 0x9f, 0x4f, 0x1e, 0x75, 0x83, 0x1e, 0xeb, 0x7f, 0xeb, 0x6d, 0x5e, 0x49, 0x65, 0x96, 0x5b,
+	0x63, 0xac, 0xb1, 0xc5, 0xef, 0x79, 0x2e, 0x73, 0x9c, 0x64, 0x92, 0x79, 0x24, 0xaa, 0xdc, 0xc7,
+	0x31, 0xed, 0xfa, 0x63, 0xf3, 0x7f, 0xd1, 0x77, 0x3e, 0x0d, 0xf0, 0x61, 0xcd, 0x83, 0x9f, 0x39,
+	0x23, 0x08, 0x3c, 0x31, 0x8c, 0x74, 0x96, 0x59, 0x0f, 0x9b, 0xd5, 0xfb, 0x8f, 0x61, 0x7f, 0xf8,
+	0xcc, 0xea, 0x8e, 0x77, 0xe8, 0x31, 0x68, 0xad, 0xbe, 0x0f, 0xdc, 0xf3, 0xf7, 0xb5, 0xd5, 0x2b,
+	0x38, 0x1f, 0xe3, 0x34, 0x97, 0x86, 0xf5, 0x1c, 0x40, 0x18, 0x79, 0xb2, 0x83, 0xa8, 0xff, 0x00,
+	0xad, 0x59, 0xff, 0x00, 0xa5, 0x17, 0x08, 0x92, 0xa8, 0x39, 0x9c, 0xa0, 0xdf, 0x13, 0xd0, 0x4b,
+	0xe0, 0x9f, 0x0f, 0x94, 0x78, 0x7d, 0x80, 0x3c, 0x62, 0x65, 0xc7, 0xfe, 0x37, 0x13, 0xed, 0xfd,
+	0x3f, 0xa8, 0xe1, 0x75, 0x2c, 0x66, 0xe5, 0x61, 0x5a, 0x2d, 0xa9, 0xdd, 0xc7, 0x20, 0xfe, 0xeb,
+	0xdb, 0xf4, 0x98, 0xe5, 0x65, 0x78, 0xef, 0xd5, 0xbe, 0xbd, 0x7f, 0x44, 0xea, 0x0c, 0xbd, 0xa4,
+	0x9c, 0x77, 0x90, 0xdc, 0x9a, 0xbb, 0x39, 0x9e, 0x3f, 0xf1, 0x8c, 0xfa, 0x4c, 0x5e, 0xbd, 0xeb,
+	0xd3, 0xe8, 0x7d, 0xa3, 0x78, 0xf4, 0x76, 0xfa, 0x9b, 0xfb, 0x6d, 0x8d, 0xfb, 0xff, 0x00, 0xcd,
+	0x57, 0x31, 0xf3, 0x1c, 0x78, 0xe5, 0x2a, 0xa9, 0x40, 0x12, 0x43, 0xcd, 0xf3, 0x7f, 0x07, 0xfb,
+	0xbf, 0x3b, 0x83, 0x09, 0x91, 0x96, 0x0e, 0x63, 0x24, 0x61, 0x09, 0xfe, 0x9d, 0x4a, 0x71, 0x84,
+	0xe2, 0x7f, 0xaf, 0x1e, 0x27, 0xff, 0xd0, 0xbf, 0xfe, 0x33, 0x2f, 0x73, 0xba, 0xa6, 0x2d, 0x1f,
+	0x9b, 0x5d, 0x1b, 0xc7, 0xc5, 0xee, 0x73, 0x5d, 0xff, 0x00, 0x9e, 0x97, 0x1a, 0xbb, 0xbf, 0xf1,
+	0x9b, 0x80, 0xfd, 0xd8, 0x9d, 0x45, 0xa2, 0x58, 0x01, 0xa2, 0xc3, 0xe0, 0x7f, 0x9c, 0xab, 0xff,
+	0x00, 0x46, 0x2e, 0x11, 0x65, 0xf3, 0x20, 0x8c, 0xd2, 0xb7, 0xbc, 0xf8, 0x24, 0xa3, 0x2f, 0x87,
+	0xe0, 0xe1, 0xe8, 0x0c, 0x4f, 0xf7, 0xf8, 0xa5, 0xc4, 0xa4, 0x92, 0x49, 0x42, 0xe9, 0x29, 0x7a,
+	0x2f, 0xdb, 0x6d, 0xff, 0x00, 0xc6, 0xd7, 0xd6, 0xd7, 0x77, 0xa3, 0xe8, 0x4f, 0xf2, 0x7d, 0x5f,
+	0xb3, 0x7f, 0xe7, 0xb5, 0xe7, 0x60, 0x12, 0x60, 0x6a, 0x4f, 0x00, 0x2f, 0x57, 0xfd, 0x87, 0x67,
+	0xfc, 0xcc, 0xfd, 0x91, 0x1f, 0xa7, 0xfb, 0x37, 0xd1, 0xff, 0x00, 0x85, 0xfe, 0x7f, 0x6f, 0xfd,
+	0xbc, 0xa7, 0xe5, 0xc1, 0xac, 0xa7, 0xa7, 0xb7, 0x27, 0x27, 0xe3, 0x12, 0x8f, 0xb9, 0xc8, 0x44,
+	0xfc, 0xe7, 0x9b, 0xc5, 0x28, 0xff, 0x00, 0x76, 0x27, 0xd7, 0xff, 0x00, 0x4a, 0x0f, 0xff, 0xd1,
+	0xf4, 0xce, 0xa3, 0xd3, 0xf1, 0xba, 0x96, 0x15, 0xb8, 0x59, 0x4d, 0xdd, 0x55, 0xc2, 0x0c, 0x72,
+	0x0f, 0xe6, 0xbd, 0xbf, 0xcb, 0x63, 0x97, 0x93, 0x75, 0xef, 0xab, 0x7d, 0x43, 0xa2, 0x5e, 0x5b,
+	0x7b, 0x0b, 0xf1, 0xc9, 0xfd, 0x16, 0x43, 0x47, 0xb1, 0xc3, 0xf9, 0x5f, 0xb9, 0x67, 0xf2, 0x17,
+	0xb1, 0x21, 0xdf, 0xe8, 0x7a, 0x2e, 0xfb, 0x46, 0xcf, 0x46, 0x3d, 0xfe, 0xa4, 0x6d, 0x8f, 0xe5,
+	0x6f, 0xf6, 0xaa, 0xfc, 0xc6, 0x3c, 0x73, 0xae, 0x29, 0x08, 0x48, 0x6c, 0x49, 0x76, 0x3e, 0x0f,
+	0xcd, 0xf3, 0xbc, 0xbf, 0x11, 0xc3, 0x83, 0x27, 0x31, 0x82, 0x47, 0xd7, 0x08, 0x46, 0x72, 0x1c,
+	0x7f, 0xd5, 0x9c, 0x23, 0x2e, 0x19, 0xbe, 0x16, 0x9c, 0x02, 0x48, 0x03, 0x52, 0x78, 0x01, 0x7a,
+	0x26, 0x6f, 0xfe, 0x36, 0xbe, 0xa1, 0xf5, 0xbd, 0x1d, 0xdd, 0xfd, 0x0f, 0x53, 0x6f, 0xfe, 0xcb,
+	0x7e, 0x8d, 0x69, 0xf4, 0x3f, 0xf9, 0x99, 0xea, 0x0f, 0xd9, 0x1f, 0x66, 0xf5, 0xff, 0x00, 0x37,
+	0xfd, 0x2f, 0xf6, 0x7d, 0x7f, 0xd2, 0xaa, 0x83, 0x97, 0x17, 0xae, 0x5c, 0x75, 0xfd, 0xe7, 0xa0,
+	0x97, 0xc6, 0x32, 0x70, 0xdc, 0x79, 0x0e, 0x6c, 0xcf, 0xf7, 0x65, 0x88, 0xc6, 0x3f, 0xe3, 0xfa,
+	0xbf, 0xe8, 0x38, 0x1f, 0x53, 0x3e, 0xa6, 0xde, 0x2f, 0xaf, 0xaa, 0x75, 0x4a, 0xcd, 0x6c, 0xae,
+	0x1f, 0x8f, 0x8e, 0xef, 0xa4, 0x5d, 0xf9, 0xb6, 0xda, 0xdf, 0xcd, 0x6b, 0x7f, 0x31, 0x8b, 0xbf,
+	0x49, 0x25, 0x72, 0x10, 0xc4, 0x31, 0x4a, 0x31, 0x90, 0x20, 0x83, 0xc5, 0x2b, 0x79, 0xbe, 0x6b,
+	0x9a, 0xe7, 0x67, 0xce, 0xe1, 0xcf, 0x9f, 0x0c, 0xe3, 0x92, 0x33, 0x84, 0xb0, 0x60, 0x94, 0x27,
+	0x0f, 0x92, 0x77, 0x18, 0x42, 0x32, 0xf5, 0x4b, 0x8a, 0x4f, 0xff, 0xd9, 0x38, 0x42, 0x49, 0x4d,
+	0x04, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x0f, 0x00, 0x41, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x50, 0x00,
+	0x68, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x73, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x70, 0x00,
+	0x00, 0x00, 0x12, 0x00, 0x41, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00,
+	0x50, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x73, 0x00, 0x68, 0x00, 0x6f, 0x00,
+	0x70, 0x00, 0x20, 0x00, 0x43, 0x00, 0x43, 0x00, 0x00, 0x00, 0x01, 0x00, 0x38, 0x42, 0x49, 0x4d,
+	0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+	0xff, 0xe1, 0x0d, 0x03, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64,
+	0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+	0x00, 0x3c, 0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x62, 0x65, 0x67, 0x69, 0x6e,
+	0x3d, 0x22, 0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d,
+	0x70, 0x43, 0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53, 0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b,
+	0x63, 0x39, 0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74,
+	0x61, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62, 0x65,
+	0x3a, 0x6e, 0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22, 0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70,
+	0x74, 0x6b, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f,
+	0x72, 0x65, 0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34, 0x32, 0x20, 0x37, 0x39, 0x2e, 0x31,
+	0x36, 0x30, 0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31, 0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31,
+	0x33, 0x2d, 0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46, 0x20, 0x78, 0x6d,
+	0x6c, 0x6e, 0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f,
+	0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f,
+	0x30, 0x32, 0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78,
+	0x2d, 0x6e, 0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x44, 0x65, 0x73, 0x63,
+	0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64, 0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75,
+	0x74, 0x3d, 0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22,
+	0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+	0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d,
+	0x6c, 0x6e, 0x73, 0x3a, 0x64, 0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x70,
+	0x75, 0x72, 0x6c, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+	0x6e, 0x74, 0x73, 0x2f, 0x31, 0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+	0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+	0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x70,
+	0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78,
+	0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70,
+	0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f,
+	0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+	0x6e, 0x73, 0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+	0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+	0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+	0x4d, 0x6f, 0x64, 0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30, 0x32, 0x31,
+	0x2d, 0x31, 0x32, 0x2d, 0x30, 0x35, 0x54, 0x32, 0x30, 0x3a, 0x35, 0x33, 0x3a, 0x30, 0x35, 0x2d,
+	0x30, 0x38, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65, 0x61, 0x74,
+	0x6f, 0x72, 0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x50, 0x68,
+	0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x28, 0x57, 0x69, 0x6e, 0x64,
+	0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65,
+	0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30, 0x32, 0x31, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x35,
+	0x54, 0x32, 0x30, 0x3a, 0x33, 0x34, 0x3a, 0x35, 0x37, 0x2d, 0x30, 0x38, 0x3a, 0x30, 0x30, 0x22,
+	0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61, 0x44, 0x61, 0x74,
+	0x65, 0x3d, 0x22, 0x32, 0x30, 0x32, 0x31, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x35, 0x54, 0x32, 0x30,
+	0x3a, 0x35, 0x33, 0x3a, 0x30, 0x35, 0x2d, 0x30, 0x38, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x64, 0x63,
+	0x3a, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x2f, 0x6a,
+	0x70, 0x65, 0x67, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43,
+	0x6f, 0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x22, 0x20, 0x78, 0x6d, 0x70,
+	0x4d, 0x4d, 0x3a, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3d, 0x22, 0x78,
+	0x6d, 0x70, 0x2e, 0x69, 0x69, 0x64, 0x3a, 0x64, 0x61, 0x64, 0x33, 0x37, 0x37, 0x37, 0x30, 0x2d,
+	0x65, 0x66, 0x61, 0x33, 0x2d, 0x66, 0x65, 0x34, 0x31, 0x2d, 0x61, 0x33, 0x38, 0x66, 0x2d, 0x66,
+	0x62, 0x34, 0x63, 0x32, 0x37, 0x63, 0x64, 0x39, 0x63, 0x66, 0x64, 0x22, 0x20, 0x78, 0x6d, 0x70,
+	0x4d, 0x4d, 0x3a, 0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44, 0x3d, 0x22, 0x78,
+	0x6d, 0x70, 0x2e, 0x64, 0x69, 0x64, 0x3a, 0x64, 0x61, 0x64, 0x33, 0x37, 0x37, 0x37, 0x30, 0x2d,
+	0x65, 0x66, 0x61, 0x33, 0x2d, 0x66, 0x65, 0x34, 0x31, 0x2d, 0x61, 0x33, 0x38, 0x66, 0x2d, 0x66,
+	0x62, 0x34, 0x63, 0x32, 0x37, 0x63, 0x64, 0x39, 0x63, 0x66, 0x64, 0x22, 0x20, 0x78, 0x6d, 0x70,
+	0x4d, 0x4d, 0x3a, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f, 0x63, 0x75, 0x6d,
+	0x65, 0x6e, 0x74, 0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69, 0x64, 0x3a, 0x64,
+	0x61, 0x64, 0x33, 0x37, 0x37, 0x37, 0x30, 0x2d, 0x65, 0x66, 0x61, 0x33, 0x2d, 0x66, 0x65, 0x34,
+	0x31, 0x2d, 0x61, 0x33, 0x38, 0x66, 0x2d, 0x66, 0x62, 0x34, 0x63, 0x32, 0x37, 0x63, 0x64, 0x39,
+	0x63, 0x66, 0x64, 0x22, 0x3e, 0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69, 0x73,
+	0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20,
+	0x3c, 0x72, 0x64, 0x66, 0x3a, 0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x61, 0x63,
+	0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45,
+	0x76, 0x74, 0x3a, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3d, 0x22, 0x78,
+	0x6d, 0x70, 0x2e, 0x69, 0x69, 0x64, 0x3a, 0x64, 0x61, 0x64, 0x33, 0x37, 0x37, 0x37, 0x30, 0x2d,
+	0x65, 0x66, 0x61, 0x33, 0x2d, 0x66, 0x65, 0x34, 0x31, 0x2d, 0x61, 0x33, 0x38, 0x66, 0x2d, 0x66,
+	0x62, 0x34, 0x63, 0x32, 0x37, 0x63, 0x64, 0x39, 0x63, 0x66, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45,
+	0x76, 0x74, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x32, 0x31, 0x2d, 0x31, 0x32,
+	0x2d, 0x30, 0x35, 0x54, 0x32, 0x30, 0x3a, 0x35, 0x33, 0x3a, 0x30, 0x35, 0x2d, 0x30, 0x38, 0x3a,
+	0x30, 0x30, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61,
+	0x72, 0x65, 0x41, 0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x50,
+	0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x28, 0x57, 0x69, 0x6e,
+	0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+	0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+	0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+	0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a, 0x44, 0x65, 0x73,
+	0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a,
+	0x52, 0x44, 0x46, 0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61,
+	0x3e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x3c, 0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x65, 0x6e, 0x64, 0x3d,
+	0x22, 0x77, 0x22, 0x3f, 0x3e, 0xff, 0xee, 0x00, 0x21, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x00, 0x64,
+	0x40, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x10, 0x03, 0x02, 0x03, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x84, 0x00, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xff, 0xc2,
+	0x00, 0x11, 0x08, 0x00, 0x2d, 0x00, 0x2d, 0x03, 0x01, 0x11, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+	0x01, 0xff, 0xc4, 0x00, 0xd8, 0x00, 0x00, 0x01, 0x04, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x07, 0x09, 0x0b, 0x01, 0x03, 0x02, 0x05, 0x06,
+	0x08, 0x01, 0x00, 0x02, 0x02, 0x02, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x07, 0x09, 0x05, 0x0a, 0x01, 0x03, 0x06, 0x02, 0x04, 0x10, 0x00, 0x00,
+	0x04, 0x03, 0x06, 0x06, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06,
+	0x07, 0x08, 0x02, 0x04, 0x05, 0x00, 0x10, 0x01, 0x11, 0x16, 0x09, 0x21, 0x14, 0x17, 0x18, 0x19,
+	0x0a, 0x20, 0x15, 0x12, 0x42, 0x1a, 0x11, 0x00, 0x01, 0x03, 0x02, 0x04, 0x04, 0x03, 0x04, 0x06,
+	0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x04, 0x05, 0x01, 0x06, 0x11, 0x12, 0x13,
+	0x07, 0x00, 0x15, 0x16, 0x17, 0x21, 0x14, 0x08, 0x31, 0x41, 0x23, 0x18, 0x10, 0x20, 0x61, 0xa1,
+	0xd1, 0x24, 0xf0, 0x51, 0x81, 0x91, 0xc1, 0x32, 0x42, 0x52, 0x25, 0x26, 0x27, 0x12, 0x00, 0x02,
+	0x01, 0x02, 0x02, 0x07, 0x05, 0x04, 0x07, 0x04, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+	0x03, 0x11, 0x04, 0x12, 0x05, 0x00, 0x21, 0x31, 0x13, 0x14, 0x15, 0x06, 0x41, 0x51, 0x22, 0x16,
+	0x07, 0x10, 0x61, 0x32, 0x23, 0x20, 0x71, 0x91, 0xa1, 0x42, 0x33, 0x24, 0x52, 0x65, 0x08, 0x18,
+	0x62, 0xa2, 0x53, 0x93, 0x44, 0x64, 0xa4, 0x25, 0x35, 0x26, 0x17, 0xff, 0xda, 0x00, 0x0c, 0x03,
+	0x01, 0x01, 0x02, 0x11, 0x03, 0x11, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x8b, 0xa8, 0xc9, 0xe5, 0x1f,
+	0xc8, 0x0e, 0xdb, 0x9f, 0x5c, 0xe4, 0x58, 0x4c, 0xcc, 0x95, 0x25, 0xbd, 0xb9, 0xb8, 0xce, 0x2e,
+	0xa3, 0x27, 0x9a, 0xbc, 0x4a, 0xfb, 0xdc, 0x07, 0xa7, 0xe9, 0xc8, 0xa0, 0x90, 0x3f, 0x7c, 0xa3,
+	0xd8, 0xd3, 0x61, 0xfa, 0x6e, 0x87, 0x12, 0x81, 0xb1, 0xb0, 0xd8, 0x2e, 0x37, 0x48, 0x81, 0x06,
+	0x79, 0x0c, 0xf1, 0xc6, 0xd6, 0xcd, 0x86, 0xc1, 0x4a, 0x82, 0x76, 0xaa, 0xdf, 0xc2, 0x04, 0x1b,
+	0xbe, 0xba, 0xec, 0x15, 0x7e, 0x75, 0x19, 0x91, 0x09, 0x05, 0x3d, 0xaf, 0x59, 0x01, 0xdb, 0xd6,
+	0x3f, 0xbc, 0x13, 0x6f, 0xbb, 0x9e, 0xb2, 0xa3, 0x68, 0x68, 0x7c, 0xbb, 0x1b, 0x4d, 0x7a, 0xf9,
+	0x07, 0x93, 0xfc, 0xb9, 0xe1, 0xd0, 0x5e, 0x2e, 0x3b, 0xed, 0xdf, 0x6a, 0xb0, 0xcb, 0xe4, 0xb9,
+	0x5e, 0x39, 0x39, 0xff, 0xda, 0x00, 0x08, 0x01, 0x02, 0x00, 0x01, 0x05, 0x00, 0xb1, 0xe1, 0x57,
+	0x2b, 0x91, 0xe2, 0x9d, 0x72, 0x46, 0x61, 0x04, 0xa1, 0x39, 0x28, 0xf1, 0x1a, 0x82, 0x61, 0xa3,
+	0x19, 0xa9, 0xd6, 0x55, 0xcf, 0x11, 0x11, 0x8b, 0x13, 0x13, 0x03, 0xcd, 0x8f, 0x72, 0x76, 0x79,
+	0x9e, 0x22, 0xd7, 0xf9, 0xd9, 0x4e, 0x49, 0xc9, 0x4e, 0x88, 0x21, 0x9b, 0xe1, 0xf7, 0x33, 0x3d,
+	0xb9, 0x39, 0x3a, 0x10, 0xd1, 0x47, 0x7c, 0x30, 0xe3, 0x14, 0x5a, 0x26, 0x63, 0xa3, 0xa6, 0x1a,
+	0x0d, 0x38, 0xcd, 0x46, 0x3c, 0xa7, 0x75, 0xf2, 0x2c, 0xf6, 0x56, 0x86, 0x18, 0xa3, 0x89, 0x1f,
+	0x47, 0xa7, 0x30, 0x9d, 0xce, 0xe9, 0xde, 0x4b, 0x94, 0xac, 0xf6, 0xe3, 0xcc, 0x12, 0x7a, 0x3b,
+	0xcc, 0xdd, 0xff, 0xda, 0x00, 0x08, 0x01, 0x03, 0x00, 0x01, 0x05, 0x00, 0xb3, 0x59, 0xdb, 0xf5,
+	0x74, 0x74, 0xe0, 0x96, 0x76, 0x4d, 0x43, 0xe4, 0xe4, 0xd5, 0x5d, 0x92, 0xa5, 0xe0, 0xa7, 0x2b,
+	0x48, 0xf2, 0x90, 0x86, 0x1c, 0xed, 0xb7, 0xeb, 0x58, 0x05, 0xd3, 0xae, 0x94, 0x8a, 0x45, 0x28,
+	0xbf, 0x4a, 0xb9, 0xe5, 0xb5, 0x42, 0xab, 0xad, 0x48, 0xb4, 0xb9, 0x87, 0x53, 0xec, 0x9a, 0x59,
+	0x92, 0x94, 0x43, 0xbe, 0x1d, 0x33, 0xa2, 0x79, 0xa2, 0xd9, 0x29, 0x56, 0xa6, 0xc1, 0x2d, 0x78,
+	0xa2, 0x84, 0x00, 0x5d, 0xd1, 0x51, 0xfc, 0x90, 0x23, 0xaa, 0xd1, 0xc9, 0x0c, 0x52, 0x1a, 0xab,
+	0xca, 0x48, 0x9d, 0x61, 0x56, 0xc2, 0x8c, 0x10, 0x01, 0x6e, 0x41, 0xb8, 0xf9, 0x6e, 0x32, 0xd7,
+	0x0b, 0x8a, 0xfa, 0x9f, 0x50, 0x26, 0x9e, 0x68, 0xbe, 0x9d, 0xd0, 0x79, 0x20, 0xfa, 0x6b, 0x71,
+	0xcf, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x01, 0x05, 0x00, 0xb3, 0xeb, 0xdd, 0xad, 0xad,
+	0x31, 0x59, 0x83, 0xb7, 0xb3, 0x1b, 0x9d, 0xa8, 0x54, 0x50, 0x8f, 0x66, 0x69, 0xb1, 0xab, 0x2d,
+	0xfd, 0xc4, 0xa3, 0x4e, 0x81, 0x38, 0xcf, 0x86, 0xed, 0x6f, 0xb2, 0x61, 0x8a, 0x35, 0xb3, 0x09,
+	0x86, 0xb8, 0x6d, 0xae, 0xdd, 0xb7, 0x13, 0xf0, 0x3d, 0xb0, 0xd7, 0x05, 0xae, 0x0a, 0x5a, 0x1b,
+	0xd9, 0x8c, 0xed, 0x53, 0xa8, 0x39, 0xeb, 0xf0, 0xb7, 0x5a, 0xcc, 0xdf, 0xcd, 0x97, 0xb3, 0x32,
+	0x0d, 0x58, 0x16, 0x73, 0x2c, 0xaf, 0x97, 0x00, 0x69, 0x91, 0xbb, 0x1d, 0x31, 0xf8, 0x68, 0x71,
+	0x28, 0x02, 0x6e, 0xe8, 0x11, 0x97, 0xdf, 0xb7, 0x13, 0x82, 0x61, 0xc7, 0xac, 0xac, 0x04, 0xb0,
+	0xf3, 0x43, 0xec, 0xd5, 0xb3, 0x59, 0xd0, 0x23, 0xaf, 0xeb, 0x8d, 0x8e, 0xfa, 0x1b, 0x49, 0x2d,
+	0x3f, 0xcd, 0x8e, 0xa3, 0x63, 0xde, 0x1a, 0x35, 0x1e, 0x3f, 0x8d, 0xb8, 0x65, 0xff, 0xda, 0x00,
+	0x08, 0x01, 0x02, 0x02, 0x06, 0x3f, 0x00, 0xd0, 0xda, 0x5d, 0x48, 0xd7, 0x39, 0xc5, 0x01, 0xdc,
+	0x45, 0x42, 0xca, 0x0e, 0xc3, 0x23, 0x1f, 0x0c, 0x60, 0x8d, 0x60, 0x1a, 0xb9, 0x1a, 0xc2, 0x11,
+	0xaf, 0x42, 0x72, 0xfc, 0x82, 0xc6, 0x28, 0xbb, 0x9c, 0xcb, 0x21, 0xfb, 0x55, 0xe2, 0x1f, 0xd5,
+	0xd2, 0x38, 0xba, 0x93, 0xa7, 0x94, 0x40, 0x76, 0xc9, 0x6e, 0xc6, 0xa3, 0x58, 0xd7, 0xba, 0x92,
+	0xb5, 0x1b, 0x49, 0xa4, 0x80, 0xf7, 0x0d, 0x22, 0xcd, 0x72, 0x3b, 0xe4, 0x9e, 0xc9, 0xfb, 0x46,
+	0xd5, 0x3d, 0xaa, 0xea, 0x68, 0xca, 0xc3, 0xb5, 0x58, 0x03, 0xdb, 0xac, 0x10, 0x7d, 0x92, 0x5d,
+	0x5a, 0x11, 0xce, 0x2e, 0x5b, 0x75, 0x05, 0x75, 0x85, 0x62, 0x2a, 0xd2, 0x10, 0x75, 0x11, 0x1a,
+	0xeb, 0x00, 0xd4, 0x17, 0x28, 0x08, 0xa1, 0x3a, 0x4d, 0x73, 0x75, 0x33, 0x49, 0x71, 0x23, 0x16,
+	0x66, 0x62, 0x4b, 0x33, 0x13, 0x52, 0x49, 0x3a, 0xc9, 0x27, 0x69, 0xf6, 0xc1, 0x7f, 0x0b, 0xb3,
+	0x65, 0x72, 0x15, 0x5b, 0x88, 0xbb, 0x1e, 0x3a, 0xed, 0x03, 0xf6, 0xd2, 0xa5, 0x90, 0xed, 0xaf,
+	0x84, 0x9c, 0x2c, 0xc0, 0xf3, 0x1d, 0xfa, 0xf0, 0x3b, 0xad, 0xe6, 0x3f, 0xc3, 0x83, 0x0e, 0x2c,
+	0x7f, 0x56, 0x1d, 0x7a, 0x64, 0x39, 0x79, 0x27, 0x73, 0x15, 0x8e, 0xf0, 0x77, 0x56, 0x49, 0x5d,
+	0x4f, 0xdd, 0x12, 0xfd, 0x1e, 0x33, 0xc5, 0xbd, 0xe0, 0xb8, 0x7d, 0xba, 0xf0, 0x71, 0x3c, 0x37,
+	0xd9, 0xbb, 0xfb, 0xb4, 0xe9, 0xfe, 0xa5, 0x8a, 0x3a, 0xc0, 0x15, 0xad, 0xe4, 0x20, 0x7c, 0x26,
+	0xa6, 0x48, 0xab, 0xee, 0x35, 0x90, 0x57, 0xbc, 0x53, 0xb7, 0xe8, 0x04, 0x55, 0x25, 0x89, 0xa0,
+	0x03, 0xb4, 0xf7, 0x53, 0xb6, 0xba, 0x79, 0x3b, 0x77, 0xfe, 0xe1, 0xcb, 0x7e, 0x1f, 0xf3, 0x15,
+	0xdf, 0xe1, 0xfe, 0xfb, 0xc3, 0xa5, 0xf6, 0x47, 0x9a, 0xc5, 0x8a, 0xca, 0x74, 0xc2, 0x69, 0xa9,
+	0x94, 0xed, 0x57, 0x52, 0x6b, 0x46, 0x46, 0x01, 0x94, 0xf7, 0x8d, 0x60, 0x8a, 0x8d, 0x1e, 0x2b,
+	0xfb, 0x73, 0x26, 0x58, 0xcd, 0x48, 0xae, 0x10, 0x13, 0x1b, 0x8e, 0xc0, 0xc7, 0xf0, 0x3f, 0x7a,
+	0x36, 0xba, 0xd4, 0xae, 0x25, 0xa3, 0x1d, 0x15, 0x54, 0x12, 0xc4, 0xd0, 0x01, 0xb4, 0x9e, 0xc0,
+	0x3b, 0xeb, 0xa5, 0xa7, 0x56, 0x75, 0x65, 0xa1, 0x8a, 0x08, 0x88, 0x7b, 0x78, 0x1c, 0x51, 0xd9,
+	0xc6, 0xb5, 0x96, 0x55, 0x3a, 0xd5, 0x57, 0xe2, 0x44, 0x34, 0x66, 0x60, 0x19, 0x80, 0x50, 0x03,
+	0xfb, 0x27, 0xe6, 0x3b, 0xae, 0x07, 0x0f, 0x8f, 0x79, 0x87, 0x05, 0x3f, 0xa7, 0x8b, 0xc3, 0x4d,
+	0x9b, 0x74, 0x3c, 0x67, 0x05, 0xbd, 0xaf, 0xf8, 0x7e, 0x27, 0x0f, 0xfa, 0x6f, 0x07, 0xd9, 0xa4,
+	0x7e, 0x4e, 0xe5, 0xbc, 0xc7, 0xf0, 0xff, 0x00, 0x6f, 0xb4, 0x7c, 0x3b, 0xff, 0x00, 0x9b, 0xb6,
+	0x9b, 0x3d, 0xbf, 0xff, 0xda, 0x00, 0x08, 0x01, 0x03, 0x02, 0x06, 0x3f, 0x00, 0xd1, 0x3a, 0x87,
+	0x21, 0xb4, 0x87, 0x24, 0xf4, 0xe0, 0x39, 0x53, 0x9a, 0xdf, 0x87, 0x58, 0xa5, 0x2b, 0x50, 0xcb,
+	0x65, 0x0a, 0x8d, 0xed, 0xe3, 0x2b, 0x0c, 0x2c, 0xc9, 0x82, 0xdd, 0x18, 0x32, 0x3c, 0xea, 0xe3,
+	0x06, 0x8a, 0x9d, 0x61, 0xea, 0xd7, 0x54, 0xdf, 0xe6, 0x14, 0xd6, 0xf6, 0x8b, 0x63, 0x65, 0x1d,
+	0x7d, 0xd1, 0xcb, 0x6f, 0x7c, 0xd4, 0xfa, 0xe5, 0x3a, 0x5d, 0xde, 0xfa, 0x2b, 0xeb, 0x14, 0xaf,
+	0x99, 0xa0, 0x25, 0x2d, 0x33, 0x88, 0x10, 0x24, 0x94, 0x04, 0x85, 0xe3, 0x6c, 0xd5, 0x77, 0x64,
+	0x9a, 0x28, 0x26, 0xcd, 0x97, 0xb4, 0x91, 0xa5, 0xff, 0x00, 0x40, 0xfa, 0xa5, 0xd2, 0xb7, 0x19,
+	0x4f, 0x52, 0xdb, 0xeb, 0xc1, 0x20, 0x06, 0x39, 0x63, 0x24, 0x85, 0x9e, 0xde, 0x64, 0x2d, 0x15,
+	0xc4, 0x0f, 0x43, 0x86, 0x58, 0x9d, 0x90, 0x90, 0xca, 0x48, 0x75, 0x65, 0x1a, 0x59, 0xe4, 0x3d,
+	0x45, 0x1c, 0x9f, 0xf9, 0xbe, 0x4b, 0x08, 0xbf, 0xcd, 0x8a, 0x92, 0xa6, 0x58, 0x95, 0xc2, 0xc1,
+	0x64, 0xae, 0xa4, 0x32, 0x35, 0xe4, 0xbe, 0x06, 0x65, 0x2a, 0xe9, 0x6e, 0x97, 0x0e, 0x8c, 0x24,
+	0x45, 0xd3, 0x2e, 0xc8, 0xf2, 0x3c, 0xba, 0x1b, 0x4c, 0x9a, 0xce, 0x04, 0x86, 0x08, 0x21, 0x45,
+	0x8e, 0x28, 0xa2, 0x8d, 0x42, 0xa4, 0x71, 0xa2, 0x80, 0xa8, 0x88, 0xa0, 0x2a, 0xa8, 0x00, 0x00,
+	0x28, 0x3d, 0xb9, 0xb7, 0x49, 0xdf, 0xdb, 0x45, 0x17, 0x5d, 0x59, 0xc7, 0x24, 0xf9, 0x35, 0xf1,
+	0x14, 0x7b, 0x6b, 0xc0, 0xb5, 0x58, 0xdd, 0xf6, 0x9b, 0x4b, 0xac, 0x22, 0x1b, 0x98, 0xce, 0x25,
+	0xc2, 0x56, 0x65, 0x5d, 0xf4, 0x31, 0x32, 0xf9, 0x2f, 0x94, 0xcd, 0xe6, 0xae, 0x3f, 0x82, 0xe1,
+	0x68, 0x37, 0xbc, 0x5e, 0xf7, 0x71, 0xb8, 0xc3, 0x5a, 0x6f, 0x37, 0xdf, 0x2e, 0x95, 0xf8, 0xb5,
+	0x69, 0xea, 0xcf, 0x58, 0x22, 0x2f, 0x32, 0xbf, 0xea, 0x95, 0xb4, 0x73, 0x4f, 0x16, 0xea, 0xca,
+	0xc6, 0xde, 0x58, 0xc1, 0x3b, 0x69, 0x8e, 0xfa, 0x52, 0x3b, 0x35, 0x9f, 0xa3, 0xe5, 0xbc, 0x11,
+	0xf2, 0xef, 0x33, 0x73, 0x8c, 0x34, 0x14, 0xe2, 0x39, 0x2f, 0x3b, 0xd9, 0xdf, 0xc5, 0xf8, 0xbe,
+	0xbd, 0x3d, 0x61, 0xf4, 0x4e, 0xf6, 0xe8, 0x26, 0x68, 0xf3, 0x43, 0x9c, 0xda, 0x21, 0x20, 0x6f,
+	0x13, 0x02, 0xd9, 0xde, 0xe1, 0x04, 0xd4, 0x98, 0xca, 0xd9, 0x12, 0x00, 0xf8, 0x5c, 0x9d, 0x8a,
+	0x7e, 0x84, 0x93, 0xcf, 0x22, 0xa4, 0x28, 0xa5, 0x99, 0x98, 0x80, 0xaa, 0xa0, 0x54, 0x92, 0x4e,
+	0xa0, 0x00, 0xd6, 0x49, 0xd4, 0x06, 0xbd, 0x3f, 0x99, 0x3e, 0x33, 0xfe, 0x9d, 0xe7, 0x4a, 0x6f,
+	0xbf, 0x74, 0xd3, 0x95, 0xef, 0xa9, 0x5a, 0x7f, 0xc7, 0xfc, 0xda, 0x57, 0xdd, 0xa7, 0x4a, 0xfa,
+	0xa5, 0xd0, 0x37, 0xc2, 0x0e, 0xa6, 0xca, 0x6e, 0x04, 0x89, 0x88, 0x13, 0x14, 0xc8, 0x41, 0x49,
+	0xad, 0xe7, 0x50, 0x54, 0xbc, 0x17, 0x11, 0x33, 0xc3, 0x2a, 0x86, 0x0c, 0x51, 0xc9, 0x56, 0x57,
+	0x0a, 0xc2, 0xda, 0xfb, 0xa4, 0xb3, 0x78, 0xec, 0xfa, 0xea, 0x18, 0x54, 0xdf, 0x64, 0xf3, 0xc8,
+	0xab, 0x79, 0x6d, 0x20, 0x1e, 0x36, 0x89, 0x4d, 0x38, 0x9b, 0x5c, 0x55, 0x31, 0xdc, 0xc4, 0x0a,
+	0xe1, 0x2a, 0x25, 0x58, 0x65, 0xc5, 0x12, 0xfb, 0xf4, 0x96, 0x79, 0xe4, 0x54, 0x81, 0x14, 0xb3,
+	0x33, 0x10, 0x15, 0x54, 0x0a, 0x96, 0x24, 0xea, 0x00, 0x0d, 0x64, 0x92, 0x00, 0x1a, 0xce, 0x9d,
+	0x43, 0xfc, 0x3f, 0x7f, 0x0f, 0xbd, 0x45, 0x1d, 0xf6, 0x65, 0x7e, 0x8f, 0x6d, 0x9b, 0xe6, 0xd6,
+	0xed, 0x8a, 0xde, 0x1b, 0x76, 0x05, 0x66, 0xb1, 0xb1, 0x9d, 0x4e, 0x19, 0xe5, 0x9c, 0x56, 0x2b,
+	0x9b, 0x88, 0xf1, 0x43, 0x1c, 0x2c, 0xf1, 0x44, 0xcf, 0x33, 0xb3, 0x5b, 0xfb, 0xbd, 0x99, 0x57,
+	0x92, 0xf8, 0xff, 0x00, 0x34, 0xef, 0x7f, 0x4d, 0xc1, 0x6f, 0x78, 0xbd, 0xe5, 0x0f, 0xe4, 0x6e,
+	0x3e, 0x76, 0x3a, 0x56, 0x9b, 0xbf, 0x15, 0x2b, 0xd9, 0xa4, 0x7e, 0x5b, 0xf3, 0x3f, 0x01, 0x83,
+	0xc3, 0xcd, 0xf9, 0x2e, 0xfe, 0x94, 0xfd, 0xf5, 0xfa, 0xaa, 0xd3, 0xf6, 0xb5, 0xe9, 0x79, 0xfc,
+	0xc8, 0xf9, 0xd3, 0xc9, 0xd5, 0xf9, 0xb4, 0xa7, 0x2a, 0xd8, 0xdf, 0x9b, 0xca, 0xff, 0x00, 0x41,
+	0x4c, 0x38, 0xbf, 0x37, 0xb3, 0xdb, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x01, 0x06, 0x3f, 0x00,
+	0xe1, 0x76, 0x8d, 0xd5, 0x23, 0x23, 0xb9, 0x7b, 0xc8, 0xa6, 0xa2, 0x72, 0x2d, 0xa5, 0xdb, 0xf2,
+	0xb1, 0x71, 0x2f, 0x14, 0x17, 0x29, 0x11, 0x1b, 0x39, 0xbd, 0xa6, 0xdd, 0x19, 0x31, 0x36, 0x6b,
+	0x77, 0x2d, 0xcb, 0x42, 0x88, 0x46, 0xd6, 0x90, 0x28, 0x94, 0x92, 0x0d, 0xaa, 0xc4, 0xad, 0x4e,
+	0x16, 0xbd, 0xbc, 0xd8, 0x1d, 0x8d, 0xb5, 0x21, 0xf5, 0x2b, 0x51, 0xb4, 0xbb, 0x5c, 0x5f, 0x57,
+	0xc4, 0x9e, 0x9f, 0xf4, 0xd0, 0xb2, 0x31, 0x57, 0x0d, 0x8a, 0xd1, 0x4b, 0xc3, 0xde, 0x96, 0x94,
+	0xc3, 0xed, 0xe1, 0x84, 0x67, 0xa9, 0x6f, 0x4e, 0xcc, 0x1b, 0xc2, 0x1c, 0x81, 0x13, 0xeb, 0xbb,
+	0x66, 0x67, 0x1e, 0x29, 0xe4, 0x75, 0x16, 0x60, 0xa0, 0x8e, 0xba, 0x26, 0xf1, 0x70, 0x74, 0xbf,
+	0x08, 0x85, 0x55, 0xad, 0x49, 0x44, 0xd0, 0x97, 0xe1, 0x4a, 0x25, 0x2a, 0xaf, 0x11, 0x5b, 0xaf,
+	0xb1, 0xb7, 0xdc, 0x45, 0xf9, 0x65, 0xcb, 0x7c, 0x1a, 0xbd, 0x8e, 0x59, 0x02, 0xfe, 0x22, 0x48,
+	0x63, 0x19, 0x5c, 0xc1, 0xdc, 0x70, 0xce, 0xd0, 0x09, 0x5b, 0x7a, 0x79, 0x92, 0x4c, 0x9a, 0x95,
+	0xa3, 0xb1, 0x08, 0xd4, 0x4a, 0xd2, 0xba, 0x52, 0xa3, 0x5a, 0x14, 0xac, 0x7d, 0xde, 0xde, 0x24,
+	0x2e, 0xab, 0x40, 0x8d, 0x6b, 0xbc, 0xbb, 0x97, 0x24, 0x4b, 0x03, 0x68, 0xc4, 0xec, 0x42, 0x74,
+	0x28, 0xa9, 0x77, 0x0c, 0x8a, 0xee, 0x6e, 0xf7, 0x72, 0xc8, 0xe3, 0x33, 0x77, 0x6d, 0x6c, 0xc8,
+	0x94, 0xeb, 0x0c, 0x65, 0x42, 0xc2, 0x59, 0x13, 0xb4, 0x11, 0x52, 0xa1, 0x11, 0x74, 0xe2, 0x62,
+	0xe8, 0xb9, 0xe5, 0xe4, 0xae, 0x0b, 0x8e, 0xe1, 0x93, 0x7b, 0x33, 0x3b, 0x39, 0x30, 0xf0, 0xf2,
+	0x12, 0xb2, 0xf2, 0xd2, 0x2e, 0x16, 0xe9, 0xfc, 0x8c, 0x83, 0xe7, 0x2b, 0x23, 0x87, 0x4f, 0x1d,
+	0xb9, 0x2a, 0x96, 0x42, 0x2d, 0x55, 0x52, 0x94, 0xaa, 0xd6, 0xb5, 0xfa, 0x60, 0x6f, 0xe8, 0x97,
+	0xaf, 0xdf, 0xed, 0x75, 0xc8, 0xf6, 0x3a, 0x0b, 0x7a, 0x2c, 0x41, 0x92, 0xa4, 0x65, 0x73, 0xd9,
+	0x85, 0x75, 0x44, 0x38, 0x92, 0x6a, 0xd1, 0x78, 0x8d, 0x17, 0x5d, 0xac, 0x93, 0xad, 0xe4, 0x61,
+	0xd1, 0x90, 0x9a, 0xa8, 0x53, 0x75, 0xaf, 0xcb, 0xb8, 0x3a, 0x17, 0xdc, 0x9e, 0x7f, 0x1f, 0xd0,
+	0x7d, 0x2b, 0xd7, 0x1d, 0x53, 0xab, 0x5e, 0x55, 0xd2, 0x3c, 0xa7, 0x9f, 0xf3, 0xfd, 0x7c, 0xb8,
+	0xf2, 0xfe, 0x4d, 0xf9, 0x8c, 0xf8, 0x63, 0xa5, 0xe3, 0x87, 0x1b, 0x05, 0xb7, 0x84, 0x21, 0x39,
+	0x35, 0xa9, 0xb1, 0x87, 0xbb, 0x59, 0x86, 0xaa, 0x56, 0x8d, 0x25, 0x2f, 0x8b, 0xee, 0xe3, 0x8a,
+	0x93, 0x32, 0x51, 0x8e, 0x5d, 0x45, 0xb4, 0xb1, 0x19, 0xa6, 0xb5, 0xf1, 0xae, 0x09, 0xa7, 0xd4,
+	0xaf, 0x87, 0xdf, 0x86, 0x1f, 0x8f, 0x1d, 0x69, 0xaa, 0xef, 0x9c, 0x76, 0x4f, 0xb3, 0x7e, 0x63,
+	0x3a, 0xf5, 0xba, 0x7f, 0xbd, 0x9d, 0x8f, 0xc7, 0x3f, 0xf3, 0xe9, 0x74, 0x8f, 0xc3, 0xc7, 0xfb,
+	0x38, 0xf4, 0xed, 0xea, 0x5e, 0x31, 0x89, 0x1c, 0x42, 0x01, 0x84, 0xd6, 0xcb, 0xdd, 0xef, 0x44,
+	0x22, 0x29, 0x31, 0xcf, 0x6a, 0xf1, 0xd5, 0xe5, 0x63, 0xf9, 0x95, 0xa5, 0x15, 0x40, 0xc5, 0x24,
+	0x87, 0x13, 0x68, 0xa2, 0x95, 0x5a, 0x52, 0x8b, 0x0a, 0x53, 0x4c, 0x6a, 0xaa, 0x7d, 0x41, 0x36,
+	0x6c, 0x12, 0xb8, 0x70, 0xe0, 0xa3, 0x00, 0x1b, 0xb7, 0x1a, 0xca, 0x73, 0x9c, 0xcb, 0xa0, 0xc4,
+	0x10, 0x88, 0x74, 0x51, 0x0a, 0x42, 0x91, 0x54, 0x4a, 0x52, 0x9a, 0x56, 0xaa, 0xad, 0x69, 0x4a,
+	0x53, 0x1e, 0x3e, 0x4c, 0x79, 0x7d, 0x3b, 0x8d, 0xf2, 0xd9, 0x9f, 0x94, 0x65, 0x56, 0x3d, 0xde,
+	0xd6, 0xee, 0xa7, 0x26, 0xc7, 0x26, 0x7c, 0xdd, 0xc4, 0xfc, 0xa6, 0x6c, 0x31, 0xf7, 0xf1, 0x7d,
+	0xec, 0x66, 0xec, 0x45, 0x2a, 0x56, 0xca, 0xbf, 0xa2, 0x15, 0x1a, 0xfa, 0xad, 0xea, 0x21, 0x4a,
+	0x44, 0x3e, 0x09, 0x46, 0xf2, 0x1a, 0xe3, 0x82, 0x74, 0x61, 0x38, 0x1b, 0x29, 0xeb, 0x76, 0x55,
+	0xb8, 0x5e, 0x34, 0x2a, 0x90, 0x44, 0x24, 0xc2, 0x4d, 0x16, 0x85, 0x8e, 0xab, 0x42, 0x9e, 0xc5,
+	0xdf, 0xf6, 0xfb, 0xcb, 0x8b, 0x6b, 0xdf, 0xc8, 0x1c, 0x76, 0x26, 0xf2, 0xc0, 0xb0, 0x72, 0x7b,
+	0x3a, 0xe6, 0x60, 0xa2, 0xd7, 0xc9, 0x36, 0x93, 0x70, 0x34, 0x95, 0x16, 0xb5, 0xd7, 0x40, 0x56,
+	0x94, 0x71, 0x18, 0xf1, 0x48, 0x26, 0xa2, 0x54, 0xa6, 0xea, 0x70, 0x0c, 0xa6, 0x57, 0xb7, 0xf0,
+	0xfb, 0xb1, 0xe0, 0x2d, 0x5b, 0x08, 0xae, 0x1c, 0xb9, 0x28, 0xc0, 0xdd, 0xb8, 0x04, 0xb3, 0x1c,
+	0xe7, 0x32, 0xe8, 0x30, 0x84, 0x21, 0x1d, 0x14, 0x42, 0x94, 0xa4, 0x55, 0x12, 0x94, 0xa6, 0x95,
+	0xad, 0x6b, 0x5a, 0x52, 0x94, 0xc7, 0x8b, 0x47, 0xd5, 0xb7, 0xab, 0x6b, 0x41, 0xcd, 0xaf, 0x0b,
+	0x6b, 0xb8, 0x65, 0x73, 0xec, 0xe6, 0xd0, 0x5c, 0x8d, 0xaa, 0xda, 0xe1, 0x99, 0xb8, 0xdb, 0xad,
+	0x2e, 0x61, 0x6f, 0x9b, 0xf2, 0x0d, 0xd0, 0x7c, 0xc4, 0x1c, 0x44, 0x11, 0x92, 0x97, 0x51, 0xb1,
+	0xce, 0x28, 0x27, 0xae, 0x5e, 0xa0, 0x67, 0x38, 0xc6, 0xdc, 0x49, 0x43, 0xbf, 0x7f, 0x1f, 0xa7,
+	0xf0, 0xe2, 0x77, 0xb9, 0x3d, 0x29, 0xd0, 0xbe, 0x49, 0x5d, 0x4d, 0xd7, 0x1c, 0xa3, 0xa4, 0xf9,
+	0x76, 0xa0, 0xf3, 0x73, 0xde, 0x7f, 0xfe, 0x1f, 0xc9, 0x6a, 0xe4, 0xc7, 0xcc, 0x7c, 0x3c, 0xd8,
+	0x7b, 0xf0, 0xe0, 0xdd, 0x65, 0xd9, 0x2e, 0x6f, 0xaf, 0x5f, 0x31, 0xd9, 0xbe, 0xf6, 0x72, 0x1d,
+	0x4c, 0xde, 0x38, 0x76, 0x43, 0xfd, 0x4f, 0x26, 0x6f, 0x6e, 0x9f, 0x87, 0xb7, 0x1e, 0x23, 0xbe,
+	0x4c, 0xfe, 0x5b, 0x3b, 0x8b, 0x91, 0x3c, 0xa7, 0x36, 0xb7, 0x76, 0xf0, 0xd6, 0x6d, 0x87, 0x29,
+	0xee, 0x9f, 0xfd, 0x0b, 0x3f, 0x98, 0xd3, 0xc7, 0xcb, 0x78, 0xe7, 0xc3, 0x8f, 0x1e, 0x3e, 0xcf,
+	0xdb, 0xfa, 0xff, 0x00, 0x7f, 0xb7, 0x8f, 0xff, 0xd9,
+};
+
+unsigned char const hud_arrow_jpg[] = {
+	0xff, 0xd8, 0xff, 0xe1, 0x05, 0xaa, 0x45, 0x78, 0x69, 0x66, 0x00, 0x00, 0x4d, 0x4d, 0x00, 0x2a,
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x01, 0x12, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x1a, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x62, 0x01, 0x1b,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6a, 0x01, 0x28, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x01, 0x31, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00,
+	0x00, 0x72, 0x01, 0x32, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x8f, 0x87, 0x69,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x0a,
+	0xfc, 0x80, 0x00, 0x00, 0x27, 0x10, 0x00, 0x0a, 0xfc, 0x80, 0x00, 0x00, 0x27, 0x10, 0x41, 0x64,
+	0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+	0x20, 0x28, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x00, 0x32, 0x30, 0x32, 0x31, 0x3a,
+	0x31, 0x32, 0x3a, 0x30, 0x35, 0x20, 0x32, 0x30, 0x3a, 0x35, 0x33, 0x3a, 0x30, 0x31, 0x00, 0x00,
+	0x00, 0x03, 0xa0, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00, 0xa0, 0x02,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2d, 0xa0, 0x03, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x03,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x01, 0x1a, 0x00, 0x05, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x1b, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x26, 0x01, 0x28, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x2e, 0x02, 0x02, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x04, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x01, 0xff, 0xd8, 0xff, 0xed, 0x00, 0x0c,
+	0x41, 0x64, 0x6f, 0x62, 0x65, 0x5f, 0x43, 0x4d, 0x00, 0x02, 0xff, 0xee, 0x00, 0x0e, 0x41, 0x64,
+	0x6f, 0x62, 0x65, 0x00, 0x64, 0x80, 0x00, 0x00, 0x00, 0x01, 0xff, 0xdb, 0x00, 0x84, 0x00, 0x0c,
+	0x08, 0x08, 0x08, 0x09, 0x08, 0x0c, 0x09, 0x09, 0x0c, 0x11, 0x0b, 0x0a, 0x0b, 0x11, 0x15, 0x0f,
+	0x0c, 0x0c, 0x0f, 0x15, 0x18, 0x13, 0x13, 0x15, 0x13, 0x13, 0x18, 0x11, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x01,
+	0x0d, 0x0b, 0x0b, 0x0d, 0x0e, 0x0d, 0x10, 0x0e, 0x0e, 0x10, 0x14, 0x0e, 0x0e, 0x0e, 0x14, 0x14,
+	0x0e, 0x0e, 0x0e, 0x0e, 0x14, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x11, 0x11, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x2d, 0x00, 0x2d, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01,
+	0x03, 0x11, 0x01, 0xff, 0xdd, 0x00, 0x04, 0x00, 0x03, 0xff, 0xc4, 0x01, 0x3f, 0x00, 0x00, 0x01,
+	0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x01, 0x00, 0x01, 0x05, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x03, 0x04,
+	0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x10, 0x00, 0x01, 0x04, 0x01, 0x03, 0x02, 0x04, 0x02,
+	0x05, 0x07, 0x06, 0x08, 0x05, 0x03, 0x0c, 0x33, 0x01, 0x00, 0x02, 0x11, 0x03, 0x04, 0x21, 0x12,
+	0x31, 0x05, 0x41, 0x51, 0x61, 0x13, 0x22, 0x71, 0x81, 0x32, 0x06, 0x14, 0x91, 0xa1, 0xb1, 0x42,
+	0x23, 0x24, 0x15, 0x52, 0xc1, 0x62, 0x33, 0x34, 0x72, 0x82, 0xd1, 0x43, 0x07, 0x25, 0x92, 0x53,
+	0xf0, 0xe1, 0xf1, 0x63, 0x73, 0x35, 0x16, 0xa2, 0xb2, 0x83, 0x26, 0x44, 0x93, 0x54, 0x64, 0x45,
+	0xc2, 0xa3, 0x74, 0x36, 0x17, 0xd2, 0x55, 0xe2, 0x65, 0xf2, 0xb3, 0x84, 0xc3, 0xd3, 0x75, 0xe3,
+	0xf3, 0x46, 0x27, 0x94, 0xa4, 0x85, 0xb4, 0x95, 0xc4, 0xd4, 0xe4, 0xf4, 0xa5, 0xb5, 0xc5, 0xd5,
+	0xe5, 0xf5, 0x56, 0x66, 0x76, 0x86, 0x96, 0xa6, 0xb6, 0xc6, 0xd6, 0xe6, 0xf6, 0x37, 0x47, 0x57,
+	0x67, 0x77, 0x87, 0x97, 0xa7, 0xb7, 0xc7, 0xd7, 0xe7, 0xf7, 0x11, 0x00, 0x02, 0x02, 0x01, 0x02,
+	0x04, 0x04, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x06, 0x05, 0x35, 0x01, 0x00, 0x02, 0x11, 0x03,
+	0x21, 0x31, 0x12, 0x04, 0x41, 0x51, 0x61, 0x71, 0x22, 0x13, 0x05, 0x32, 0x81, 0x91, 0x14, 0xa1,
+	0xb1, 0x42, 0x23, 0xc1, 0x52, 0xd1, 0xf0, 0x33, 0x24, 0x62, 0xe1, 0x72, 0x82, 0x92, 0x43, 0x53,
+	0x15, 0x63, 0x73, 0x34, 0xf1, 0x25, 0x06, 0x16, 0xa2, 0xb2, 0x83, 0x07, 0x26, 0x35, 0xc2, 0xd2,
+	0x44, 0x93, 0x54, 0xa3, 0x17, 0x64, 0x45, 0x55, 0x36, 0x74, 0x65, 0xe2, 0xf2, 0xb3, 0x84, 0xc3,
+	0xd3, 0x75, 0xe3, 0xf3, 0x46, 0x94, 0xa4, 0x85, 0xb4, 0x95, 0xc4, 0xd4, 0xe4, 0xf4, 0xa5, 0xb5,
+	0xc5, 0xd5, 0xe5, 0xf5, 0x56, 0x66, 0x76, 0x86, 0x96, 0xa6, 0xb6, 0xc6, 0xd6, 0xe6, 0xf6, 0x27,
+	0x37, 0x47, 0x57, 0x67, 0x77, 0x87, 0x97, 0xa7, 0xb7, 0xc7, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01,
+	0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xf5, 0x54, 0x90, 0x6c, 0xc9, 0xae, 0xbf, 0xa4,
+	0x61, 0x0f, 0xf6, 0x85, 0x1f, 0xbc, 0x12, 0x53, 0x64, 0xa0, 0x9c, 0x86, 0x82, 0x40, 0xd4, 0x0e,
+	0x48, 0x41, 0xb7, 0xa8, 0x53, 0xb0, 0xc3, 0x82, 0xe2, 0x3e, 0xb6, 0xf5, 0x2e, 0xad, 0x8f, 0x9b,
+	0x87, 0x97, 0x8b, 0x60, 0x66, 0x15, 0x67, 0x76, 0x2b, 0x99, 0xab, 0x4d, 0xd1, 0xfa, 0x7a, 0xf2,
+	0xdb, 0xfb, 0xfb, 0x7d, 0x8c, 0xaf, 0xe8, 0x7d, 0x9f, 0xe8, 0x26, 0xce, 0x62, 0x11, 0xe2, 0x20,
+	0x9f, 0x26, 0x7e, 0x57, 0x96, 0x97, 0x31, 0x94, 0x62, 0x8c, 0xa3, 0x19, 0x48, 0x12, 0x38, 0xff,
+	0x00, 0xab, 0xfa, 0x2f, 0xa0, 0xb1, 0xed, 0x78, 0x91, 0xc2, 0x9a, 0xe7, 0x7e, 0xaf, 0xf5, 0xea,
+	0x3a, 0x86, 0x2b, 0x72, 0x6a, 0xf6, 0x09, 0x0c, 0xc8, 0xa4, 0x99, 0x35, 0x58, 0x7f, 0x37, 0xf9,
+	0x55, 0x59, 0xf4, 0xa9, 0xb1, 0x6f, 0xfa, 0x83, 0x66, 0xee, 0xc8, 0xf1, 0x0e, 0x1e, 0x2b, 0xf4,
+	0xd5, 0xdf, 0x82, 0xc3, 0x87, 0x20, 0xcb, 0xec, 0x98, 0x91, 0x97, 0x8b, 0xdb, 0xe0, 0xeb, 0xc6,
+	0x7d, 0x34, 0xff, 0x00, 0xff, 0xd0, 0xe8, 0x7e, 0xb1, 0xf5, 0x6c, 0xdc, 0x4c, 0x8a, 0x1b, 0x8e,
+	0x58, 0x1b, 0x65, 0x6e, 0x73, 0xb7, 0xd6, 0x1e, 0x64, 0x3c, 0xb3, 0x97, 0x7f, 0x25, 0x62, 0xbb,
+	0xeb, 0x1f, 0x56, 0x1c, 0x3a, 0x9f, 0xfb, 0x61, 0x8b, 0xb1, 0xea, 0x9d, 0x03, 0x0b, 0x3a, 0xd6,
+	0xd9, 0x91, 0x53, 0x9e, 0xea, 0xda, 0x58, 0xd2, 0xdb, 0x1c, 0xcd, 0x09, 0xdf, 0xc3, 0x3f, 0x94,
+	0xa8, 0x1f, 0xaa, 0x1d, 0x24, 0xf3, 0x8d, 0x6f, 0xfd, 0xbe, 0xff, 0x00, 0xee, 0x55, 0xf2, 0x63,
+	0xcc, 0x64, 0x4c, 0x65, 0x40, 0xed, 0xab, 0xb1, 0xca, 0xf3, 0x7f, 0x0e, 0x86, 0x18, 0x47, 0x36,
+	0x0e, 0x2c, 0x91, 0x1e, 0xb9, 0x7b, 0x70, 0x95, 0xeb, 0xfb, 0xd2, 0x2f, 0x30, 0xef, 0xac, 0xfd,
+	0x64, 0x7e, 0x75, 0x1f, 0xf6, 0xc3, 0x15, 0x5c, 0xbf, 0xac, 0x3d, 0x53, 0x27, 0x16, 0xcc, 0x4b,
+	0x8d, 0x07, 0x1e, 0xef, 0xe7, 0x18, 0xda, 0x18, 0xd9, 0x23, 0xe8, 0xbf, 0x73, 0x7d, 0xcd, 0xb1,
+	0x9f, 0x98, 0xf5, 0xd7, 0x3f, 0xea, 0x77, 0x46, 0x00, 0x93, 0x8d, 0x6f, 0xfd, 0xbe, 0xff, 0x00,
+	0xee, 0x58, 0x3f, 0x58, 0x7a, 0x7f, 0x40, 0xe9, 0x98, 0xa1, 0x95, 0xe3, 0x58, 0xde, 0xa1, 0x7e,
+	0xb4, 0xb0, 0xde, 0xe7, 0x86, 0x33, 0xfe, 0xe4, 0xdc, 0xdd, 0x3f, 0xeb, 0x35, 0xff, 0x00, 0x84,
+	0x51, 0xce, 0x19, 0x84, 0x49, 0x94, 0xf4, 0xfe, 0xf1, 0x6e, 0xf2, 0xfc, 0xd7, 0xc3, 0xb2, 0x65,
+	0x84, 0x31, 0x72, 0xc7, 0xdc, 0x27, 0xd3, 0x58, 0xb1, 0x8e, 0x1a, 0xfd, 0x2b, 0xe2, 0xf4, 0xf0,
+	0xb8, 0x5d, 0x2f, 0xab, 0x64, 0x74, 0x9c, 0xc6, 0xe5, 0xd3, 0xee, 0x6c, 0x6d, 0xba, 0xa7, 0x18,
+	0x6d, 0x95, 0xfe, 0x75, 0x6f, 0xff, 0x00, 0xaa, 0xad, 0xff, 0x00, 0xe0, 0xde, 0xbd, 0x4b, 0xed,
+	0xd5, 0x7e, 0xc5, 0x39, 0xfb, 0x6d, 0xf4, 0x3d, 0x2f, 0x5f, 0xd3, 0xda, 0x7d, 0x5d, 0x9b, 0x77,
+	0xfa, 0x7e, 0x9f, 0xfa, 0x45, 0xc4, 0x7d, 0x52, 0xfa, 0xb7, 0xf6, 0xdb, 0x19, 0xd4, 0xf3, 0x59,
+	0xbb, 0x11, 0x8e, 0xfd, 0x5a, 0x97, 0x7f, 0x86, 0x7b, 0x4f, 0xf3, 0x8f, 0xff, 0x00, 0xba, 0xd5,
+	0x3b, 0xfe, 0xde, 0xb1, 0x7a, 0x37, 0xa3, 0x67, 0xa5, 0x3b, 0xbf, 0x49, 0xf4, 0xa7, 0xcd, 0x3b,
+	0x14, 0x64, 0x30, 0xcc, 0x9d, 0x8c, 0x4f, 0x08, 0xfa, 0x31, 0x73, 0xf9, 0xb0, 0x4f, 0xe2, 0x3c,
+	0xb4, 0x71, 0x80, 0x72, 0x63, 0xc9, 0x8e, 0x39, 0x72, 0x0d, 0xbe, 0x78, 0xd6, 0x3f, 0xf0, 0x1f,
+	0xff, 0xd1, 0xf5, 0x48, 0x09, 0x40, 0x4e, 0x92, 0x4a, 0x60, 0xf6, 0x82, 0xd2, 0x21, 0x73, 0x3d,
+	0x6b, 0xea, 0x96, 0x27, 0x55, 0xcf, 0xa7, 0x2e, 0xd2, 0x6a, 0x20, 0x86, 0xe5, 0x35, 0xa0, 0xfe,
+	0x9a, 0xb6, 0x8f, 0xd1, 0xb7, 0x77, 0xf8, 0x27, 0xff, 0x00, 0x83, 0xf5, 0x3f, 0xd0, 0xae, 0xa5,
+	0x47, 0xdb, 0x3a, 0xf2, 0x9b, 0x31, 0x02, 0x3d, 0x75, 0x57, 0xd5, 0x9f, 0x96, 0x97, 0x31, 0x1c,
+	0x97, 0xcb, 0xf1, 0xfb, 0x94, 0x7f, 0x9b, 0x1c, 0x52, 0xe1, 0xfd, 0x2d, 0x22, 0xd6, 0xc5, 0xc5,
+	0x6d, 0x60, 0x7b, 0x43, 0x43, 0x40, 0x6b, 0x18, 0xd1, 0x0d, 0x6b, 0x46, 0x8c, 0x63, 0x1b, 0xf9,
+	0xad, 0x6a, 0xb4, 0x92, 0x74, 0xe6, 0x1d, 0x6f, 0xc6, 0xff, 0x00, 0x17, 0xff, 0xd9, 0xff, 0xed,
+	0x0d, 0x92, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x33, 0x2e, 0x30, 0x00,
+	0x38, 0x42, 0x49, 0x4d, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1c, 0x02, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0xe8, 0xf1, 0x5c, 0xf3, 0x2f, 0xc1, 0x18, 0xa1, 0xa2, 0x7b, 0x67, 0xad, 0xc5, 0x64, 0xd5, 0xba,
+	0x38, 0x42, 0x49, 0x4d, 0x04, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x10,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x4f,
+	0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x50, 0x73, 0x74,
+	0x53, 0x62, 0x6f, 0x6f, 0x6c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x74, 0x65, 0x65, 0x6e,
+	0x75, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x43, 0x6c,
+	0x72, 0x6d, 0x00, 0x00, 0x00, 0x0f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x53, 0x69, 0x78, 0x74, 0x65,
+	0x65, 0x6e, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x70, 0x72,
+	0x69, 0x6e, 0x74, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x54, 0x45, 0x58, 0x54, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x50, 0x72, 0x6f, 0x6f,
+	0x66, 0x53, 0x65, 0x74, 0x75, 0x70, 0x4f, 0x62, 0x6a, 0x63, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x50,
+	0x00, 0x72, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x53, 0x00, 0x65, 0x00, 0x74,
+	0x00, 0x75, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x70, 0x72, 0x6f, 0x6f, 0x66, 0x53,
+	0x65, 0x74, 0x75, 0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x42, 0x6c, 0x74, 0x6e,
+	0x65, 0x6e, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x0c, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x50,
+	0x72, 0x6f, 0x6f, 0x66, 0x00, 0x00, 0x00, 0x09, 0x70, 0x72, 0x6f, 0x6f, 0x66, 0x43, 0x4d, 0x59,
+	0x4b, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2d, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x70, 0x72, 0x69, 0x6e,
+	0x74, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x00,
+	0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x43, 0x70, 0x74, 0x6e, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x43, 0x6c, 0x62, 0x72, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x52, 0x67, 0x73, 0x4d, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x72, 0x6e,
+	0x43, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x6e, 0x74, 0x43, 0x62, 0x6f,
+	0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x62, 0x6c, 0x73, 0x62, 0x6f, 0x6f, 0x6c, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x4e, 0x67, 0x74, 0x76, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x45, 0x6d, 0x6c, 0x44, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x6e,
+	0x74, 0x72, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x63, 0x6b, 0x67, 0x4f,
+	0x62, 0x6a, 0x63, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x47, 0x42,
+	0x43, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x52, 0x64, 0x20, 0x20, 0x64, 0x6f, 0x75,
+	0x62, 0x40, 0x6f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x72, 0x6e,
+	0x20, 0x64, 0x6f, 0x75, 0x62, 0x40, 0x6f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x42, 0x6c, 0x20, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x40, 0x6f, 0xe0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x72, 0x64, 0x54, 0x55, 0x6e, 0x74, 0x46, 0x23, 0x52, 0x6c,
+	0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x6c, 0x64,
+	0x20, 0x55, 0x6e, 0x74, 0x46, 0x23, 0x52, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x73, 0x6c, 0x74, 0x55, 0x6e, 0x74, 0x46, 0x23, 0x50, 0x78,
+	0x6c, 0x40, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x76, 0x65, 0x63,
+	0x74, 0x6f, 0x72, 0x44, 0x61, 0x74, 0x61, 0x62, 0x6f, 0x6f, 0x6c, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x50, 0x67, 0x50, 0x73, 0x65, 0x6e, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x50, 0x67, 0x50, 0x73,
+	0x00, 0x00, 0x00, 0x00, 0x50, 0x67, 0x50, 0x43, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x65, 0x66, 0x74,
+	0x55, 0x6e, 0x74, 0x46, 0x23, 0x52, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x54, 0x6f, 0x70, 0x20, 0x55, 0x6e, 0x74, 0x46, 0x23, 0x52, 0x6c, 0x74,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x63, 0x6c, 0x20,
+	0x55, 0x6e, 0x74, 0x46, 0x23, 0x50, 0x72, 0x63, 0x40, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x63, 0x72, 0x6f, 0x70, 0x57, 0x68, 0x65, 0x6e, 0x50, 0x72, 0x69, 0x6e,
+	0x74, 0x69, 0x6e, 0x67, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x63, 0x72, 0x6f,
+	0x70, 0x52, 0x65, 0x63, 0x74, 0x42, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x6c, 0x6f, 0x6e, 0x67, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x72, 0x6f, 0x70, 0x52, 0x65, 0x63, 0x74, 0x4c,
+	0x65, 0x66, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x63,
+	0x72, 0x6f, 0x70, 0x52, 0x65, 0x63, 0x74, 0x52, 0x69, 0x67, 0x68, 0x74, 0x6c, 0x6f, 0x6e, 0x67,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x63, 0x72, 0x6f, 0x70, 0x52, 0x65, 0x63, 0x74,
+	0x54, 0x6f, 0x70, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4d,
+	0x03, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
+	0x00, 0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x26, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80,
+	0x00, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x03, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x0d, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x5a, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x19, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1e, 0x38, 0x42, 0x49, 0x4d, 0x03, 0xf3, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x38, 0x42,
+	0x49, 0x4d, 0x27, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x38, 0x42, 0x49, 0x4d, 0x03, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+	0x00, 0x2f, 0x66, 0x66, 0x00, 0x01, 0x00, 0x6c, 0x66, 0x66, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x2f, 0x66, 0x66, 0x00, 0x01, 0x00, 0xa1, 0x99, 0x9a, 0x00, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x32, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x06,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2d, 0x00, 0x00,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x38, 0x42, 0x49, 0x4d, 0x03, 0xf8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xe8, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x03, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x03, 0xe8, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
+	0x38, 0x42, 0x49, 0x4d, 0x04, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0x38, 0x42, 0x49, 0x4d, 0x04, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3f, 0x00, 0x00, 0x00, 0x06,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d,
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x61, 0x00, 0x72, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x77, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x06, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x73, 0x4f, 0x62, 0x6a, 0x63, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x63, 0x74, 0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x54, 0x6f, 0x70, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4c, 0x65, 0x66, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x42, 0x74, 0x6f, 0x6d, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x00, 0x52, 0x67, 0x68, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x06, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x73, 0x56, 0x6c, 0x4c, 0x73, 0x00, 0x00, 0x00, 0x01, 0x4f,
+	0x62, 0x6a, 0x63, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x6c, 0x69,
+	0x63, 0x65, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x07, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x49,
+	0x44, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x72, 0x6f,
+	0x75, 0x70, 0x49, 0x44, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x65, 0x6e, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x0c, 0x45, 0x53,
+	0x6c, 0x69, 0x63, 0x65, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x0d, 0x61, 0x75,
+	0x74, 0x6f, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x54,
+	0x79, 0x70, 0x65, 0x65, 0x6e, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x0a, 0x45, 0x53, 0x6c, 0x69, 0x63,
+	0x65, 0x54, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x49, 0x6d, 0x67, 0x20, 0x00, 0x00, 0x00,
+	0x06, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x73, 0x4f, 0x62, 0x6a, 0x63, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x63, 0x74, 0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x54, 0x6f, 0x70, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4c, 0x65, 0x66, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x42, 0x74, 0x6f, 0x6d, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x00, 0x52, 0x67, 0x68, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x03, 0x75, 0x72, 0x6c, 0x54, 0x45, 0x58, 0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x54, 0x45, 0x58, 0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x4d, 0x73, 0x67, 0x65, 0x54, 0x45, 0x58, 0x54, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x61, 0x6c, 0x74, 0x54, 0x61, 0x67, 0x54, 0x45, 0x58, 0x54,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x63, 0x65, 0x6c, 0x6c, 0x54, 0x65,
+	0x78, 0x74, 0x49, 0x73, 0x48, 0x54, 0x4d, 0x4c, 0x62, 0x6f, 0x6f, 0x6c, 0x01, 0x00, 0x00, 0x00,
+	0x08, 0x63, 0x65, 0x6c, 0x6c, 0x54, 0x65, 0x78, 0x74, 0x54, 0x45, 0x58, 0x54, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x68, 0x6f, 0x72, 0x7a, 0x41, 0x6c, 0x69, 0x67, 0x6e,
+	0x65, 0x6e, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x0f, 0x45, 0x53, 0x6c, 0x69, 0x63, 0x65, 0x48, 0x6f,
+	0x72, 0x7a, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x00, 0x00, 0x00, 0x07, 0x64, 0x65, 0x66, 0x61, 0x75,
+	0x6c, 0x74, 0x00, 0x00, 0x00, 0x09, 0x76, 0x65, 0x72, 0x74, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x65,
+	0x6e, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x0f, 0x45, 0x53, 0x6c, 0x69, 0x63, 0x65, 0x56, 0x65, 0x72,
+	0x74, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x00, 0x00, 0x00, 0x07, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c,
+	0x74, 0x00, 0x00, 0x00, 0x0b, 0x62, 0x67, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x54, 0x79, 0x70, 0x65,
+	0x65, 0x6e, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x11, 0x45, 0x53, 0x6c, 0x69, 0x63, 0x65, 0x42, 0x47,
+	0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x54, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x6f, 0x6e,
+	0x65, 0x00, 0x00, 0x00, 0x09, 0x74, 0x6f, 0x70, 0x4f, 0x75, 0x74, 0x73, 0x65, 0x74, 0x6c, 0x6f,
+	0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x6c, 0x65, 0x66, 0x74, 0x4f, 0x75,
+	0x74, 0x73, 0x65, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
+	0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x4f, 0x75, 0x74, 0x73, 0x65, 0x74, 0x6c, 0x6f, 0x6e, 0x67,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x72, 0x69, 0x67, 0x68, 0x74, 0x4f, 0x75, 0x74,
+	0x73, 0x65, 0x74, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4d,
+	0x04, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x3f, 0xf0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x01, 0x00, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x06, 0x38, 0x42, 0x49, 0x4d, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x90, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+	0x17, 0xe8, 0x00, 0x00, 0x04, 0x74, 0x00, 0x18, 0x00, 0x01, 0xff, 0xd8, 0xff, 0xed, 0x00, 0x0c,
+	0x41, 0x64, 0x6f, 0x62, 0x65, 0x5f, 0x43, 0x4d, 0x00, 0x02, 0xff, 0xee, 0x00, 0x0e, 0x41, 0x64,
+	0x6f, 0x62, 0x65, 0x00, 0x64, 0x80, 0x00, 0x00, 0x00, 0x01, 0xff, 0xdb, 0x00, 0x84, 0x00, 0x0c,
+	0x08, 0x08, 0x08, 0x09, 0x08, 0x0c, 0x09, 0x09, 0x0c, 0x11, 0x0b, 0x0a, 0x0b, 0x11, 0x15, 0x0f,
+	0x0c, 0x0c, 0x0f, 0x15, 0x18, 0x13, 0x13, 0x15, 0x13, 0x13, 0x18, 0x11, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x01,
+	0x0d, 0x0b, 0x0b, 0x0d, 0x0e, 0x0d, 0x10, 0x0e, 0x0e, 0x10, 0x14, 0x0e, 0x0e, 0x0e, 0x14, 0x14,
+	0x0e, 0x0e, 0x0e, 0x0e, 0x14, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x11, 0x11, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x2d, 0x00, 0x2d, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01,
+	0x03, 0x11, 0x01, 0xff, 0xdd, 0x00, 0x04, 0x00, 0x03, 0xff, 0xc4, 0x01, 0x3f, 0x00, 0x00, 0x01,
+	0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x01, 0x00, 0x01, 0x05, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x03, 0x04,
+	0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x10, 0x00, 0x01, 0x04, 0x01, 0x03, 0x02, 0x04, 0x02,
+	0x05, 0x07, 0x06, 0x08, 0x05, 0x03, 0x0c, 0x33, 0x01, 0x00, 0x02, 0x11, 0x03, 0x04, 0x21, 0x12,
+	0x31, 0x05, 0x41, 0x51, 0x61, 0x13, 0x22, 0x71, 0x81, 0x32, 0x06, 0x14, 0x91, 0xa1, 0xb1, 0x42,
+	0x23, 0x24, 0x15, 0x52, 0xc1, 0x62, 0x33, 0x34, 0x72, 0x82, 0xd1, 0x43, 0x07, 0x25, 0x92, 0x53,
+	0xf0, 0xe1, 0xf1, 0x63, 0x73, 0x35, 0x16, 0xa2, 0xb2, 0x83, 0x26, 0x44, 0x93, 0x54, 0x64, 0x45,
+	0xc2, 0xa3, 0x74, 0x36, 0x17, 0xd2, 0x55, 0xe2, 0x65, 0xf2, 0xb3, 0x84, 0xc3, 0xd3, 0x75, 0xe3,
+	0xf3, 0x46, 0x27, 0x94, 0xa4, 0x85, 0xb4, 0x95, 0xc4, 0xd4, 0xe4, 0xf4, 0xa5, 0xb5, 0xc5, 0xd5,
+	0xe5, 0xf5, 0x56, 0x66, 0x76, 0x86, 0x96, 0xa6, 0xb6, 0xc6, 0xd6, 0xe6, 0xf6, 0x37, 0x47, 0x57,
+	0x67, 0x77, 0x87, 0x97, 0xa7, 0xb7, 0xc7, 0xd7, 0xe7, 0xf7, 0x11, 0x00, 0x02, 0x02, 0x01, 0x02,
+	0x04, 0x04, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x06, 0x05, 0x35, 0x01, 0x00, 0x02, 0x11, 0x03,
+	0x21, 0x31, 0x12, 0x04, 0x41, 0x51, 0x61, 0x71, 0x22, 0x13, 0x05, 0x32, 0x81, 0x91, 0x14, 0xa1,
+	0xb1, 0x42, 0x23, 0xc1, 0x52, 0xd1, 0xf0, 0x33, 0x24, 0x62, 0xe1, 0x72, 0x82, 0x92, 0x43, 0x53,
+	0x15, 0x63, 0x73, 0x34, 0xf1, 0x25, 0x06, 0x16, 0xa2, 0xb2, 0x83, 0x07, 0x26, 0x35, 0xc2, 0xd2,
+	0x44, 0x93, 0x54, 0xa3, 0x17, 0x64, 0x45, 0x55, 0x36, 0x74, 0x65, 0xe2, 0xf2, 0xb3, 0x84, 0xc3,
+	0xd3, 0x75, 0xe3, 0xf3, 0x46, 0x94, 0xa4, 0x85, 0xb4, 0x95, 0xc4, 0xd4, 0xe4, 0xf4, 0xa5, 0xb5,
+	0xc5, 0xd5, 0xe5, 0xf5, 0x56, 0x66, 0x76, 0x86, 0x96, 0xa6, 0xb6, 0xc6, 0xd6, 0xe6, 0xf6, 0x27,
+	0x37, 0x47, 0x57, 0x67, 0x77, 0x87, 0x97, 0xa7, 0xb7, 0xc7, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01,
+	0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xf5, 0x54, 0x90, 0x6c, 0xc9, 0xae, 0xbf, 0xa4,
+	0x61, 0x0f, 0xf6, 0x85, 0x1f, 0xbc, 0x12, 0x53, 0x64, 0xa0, 0x9c, 0x86, 0x82, 0x40, 0xd4, 0x0e,
+	0x48, 0x41, 0xb7, 0xa8, 0x53, 0xb0, 0xc3, 0x82, 0xe2, 0x3e, 0xb6, 0xf5, 0x2e, 0xad, 0x8f, 0x9b,
+	0x87, 0x97, 0x8b, 0x60, 0x66, 0x15, 0x67, 0x76, 0x2b, 0x99, 0xab, 0x4d, 0xd1, 0xfa, 0x7a, 0xf2,
+	0xdb, 0xfb, 0xfb, 0x7d, 0x8c, 0xaf, 0xe8, 0x7d, 0x9f, 0xe8, 0x26, 0xce, 0x62, 0x11, 0xe2, 0x20,
+	0x9f, 0x26, 0x7e, 0x57, 0x96, 0x97, 0x31, 0x94, 0x62, 0x8c, 0xa3, 0x19, 0x48, 0x12, 0x38, 0xff,
+	0x00, 0xab, 0xfa, 0x2f, 0xa0, 0xb1, 0xed, 0x78, 0x91, 0xc2, 0x9a, 0xe7, 0x7e, 0xaf, 0xf5, 0xea,
+	0x3a, 0x86, 0x2b, 0x72, 0x6a, 0xf6, 0x09, 0x0c, 0xc8, 0xa4, 0x99, 0x35, 0x58, 0x7f, 0x37, 0xf9,
+	0x55, 0x59, 0xf4, 0xa9, 0xb1, 0x6f, 0xfa, 0x83, 0x66, 0xee, 0xc8, 0xf1, 0x0e, 0x1e, 0x2b, 0xf4,
+	0xd5, 0xdf, 0x82, 0xc3, 0x87, 0x20, 0xcb, 0xec, 0x98, 0x91, 0x97, 0x8b, 0xdb, 0xe0, 0xeb, 0xc6,
+	0x7d, 0x34, 0xff, 0x00, 0xff, 0xd0, 0xe8, 0x7e, 0xb1, 0xf5, 0x6c, 0xdc, 0x4c, 0x8a, 0x1b, 0x8e,
+	0x58, 0x1b, 0x65, 0x6e, 0x73, 0xb7, 0xd6, 0x1e, 0x64, 0x3c, 0xb3, 0x97, 0x7f, 0x25, 0x62, 0xbb,
+	0xeb, 0x1f, 0x56, 0x1c, 0x3a, 0x9f, 0xfb, 0x61, 0x8b, 0xb1, 0xea, 0x9d, 0x03, 0x0b, 0x3a, 0xd6,
+	0xd9, 0x91, 0x53, 0x9e, 0xea, 0xda, 0x58, 0xd2, 0xdb, 0x1c, 0xcd, 0x09, 0xdf, 0xc3, 0x3f, 0x94,
+	0xa8, 0x1f, 0xaa, 0x1d, 0x24, 0xf3, 0x8d, 0x6f, 0xfd, 0xbe, 0xff, 0x00, 0xee, 0x55, 0xf2, 0x63,
+	0xcc, 0x64, 0x4c, 0x65, 0x40, 0xed, 0xab, 0xb1, 0xca, 0xf3, 0x7f, 0x0e, 0x86, 0x18, 0x47, 0x36,
+	0x0e, 0x2c, 0x91, 0x1e, 0xb9, 0x7b, 0x70, 0x95, 0xeb, 0xfb, 0xd2, 0x2f, 0x30, 0xef, 0xac, 0xfd,
+	0x64, 0x7e, 0x75, 0x1f, 0xf6, 0xc3, 0x15, 0x5c, 0xbf, 0xac, 0x3d, 0x53, 0x27, 0x16, 0xcc, 0x4b,
+	0x8d, 0x07, 0x1e, 0xef, 0xe7, 0x18, 0xda, 0x18, 0xd9, 0x23, 0xe8, 0xbf, 0x73, 0x7d, 0xcd, 0xb1,
+	0x9f, 0x98, 0xf5, 0xd7, 0x3f, 0xea, 0x77, 0x46, 0x00, 0x93, 0x8d, 0x6f, 0xfd, 0xbe, 0xff, 0x00,
+	0xee, 0x58, 0x3f, 0x58, 0x7a, 0x7f, 0x40, 0xe9, 0x98, 0xa1, 0x95, 0xe3, 0x58, 0xde, 0xa1, 0x7e,
+	0xb4, 0xb0, 0xde, 0xe7, 0x86, 0x33, 0xfe, 0xe4, 0xdc, 0xdd, 0x3f, 0xeb, 0x35, 0xff, 0x00, 0x84,
+	0x51, 0xce, 0x19, 0x84, 0x49, 0x94, 0xf4, 0xfe, 0xf1, 0x6e, 0xf2, 0xfc, 0xd7, 0xc3, 0xb2, 0x65,
+	0x84, 0x31, 0x72, 0xc7, 0xdc, 0x27, 0xd3, 0x58, 0xb1, 0x8e, 0x1a, 0xfd, 0x2b, 0xe2, 0xf4, 0xf0,
+	0xb8, 0x5d, 0x2f, 0xab, 0x64, 0x74, 0x9c, 0xc6, 0xe5, 0xd3, 0xee, 0x6c, 0x6d, 0xba, 0xa7, 0x18,
+	0x6d, 0x95, 0xfe, 0x75, 0x6f, 0xff, 0x00, 0xaa, 0xad, 0xff, 0x00, 0xe0, 0xde, 0xbd, 0x4b, 0xed,
+	0xd5, 0x7e, 0xc5, 0x39, 0xfb, 0x6d, 0xf4, 0x3d, 0x2f, 0x5f, 0xd3, 0xda, 0x7d, 0x5d, 0x9b, 0x77,
+	0xfa, 0x7e, 0x9f, 0xfa, 0x45, 0xc4, 0x7d, 0x52, 0xfa, 0xb7, 0xf6, 0xdb, 0x19, 0xd4, 0xf3, 0x59,
+	0xbb, 0x11, 0x8e, 0xfd, 0x5a, 0x97, 0x7f, 0x86, 0x7b, 0x4f, 0xf3, 0x8f, 0xff, 0x00, 0xba, 0xd5,
+	0x3b, 0xfe, 0xde, 0xb1, 0x7a, 0x37, 0xa3, 0x67, 0xa5, 0x3b, 0xbf, 0x49, 0xf4, 0xa7, 0xcd, 0x3b,
+	0x14, 0x64, 0x30, 0xcc, 0x9d, 0x8c, 0x4f, 0x08, 0xfa, 0x31, 0x73, 0xf9, 0xb0, 0x4f, 0xe2, 0x3c,
+	0xb4, 0x71, 0x80, 0x72, 0x63, 0xc9, 0x8e, 0x39, 0x72, 0x0d, 0xbe, 0x78, 0xd6, 0x3f, 0xf0, 0x1f,
+	0xff, 0xd1, 0xf5, 0x48, 0x09, 0x40, 0x4e, 0x92, 0x4a, 0x60, 0xf6, 0x82, 0xd2, 0x21, 0x73, 0x3d,
+	0x6b, 0xea, 0x96, 0x27, 0x55, 0xcf, 0xa7, 0x2e, 0xd2, 0x6a, 0x20, 0x86, 0xe5, 0x35, 0xa0, 0xfe,
+	0x9a, 0xb6, 0x8f, 0xd1, 0xb7, 0x77, 0xf8, 0x27, 0xff, 0x00, 0x83, 0xf5, 0x3f, 0xd0, 0xae, 0xa5,
+	0x47, 0xdb, 0x3a, 0xf2, 0x9b, 0x31, 0x02, 0x3d, 0x75, 0x57, 0xd5, 0x9f, 0x96, 0x97, 0x31, 0x1c,
+	0x97, 0xcb, 0xf1, 0xfb, 0x94, 0x7f, 0x9b, 0x1c, 0x52, 0xe1, 0xfd, 0x2d, 0x22, 0xd6, 0xc5, 0xc5,
+	0x6d, 0x60, 0x7b, 0x43, 0x43, 0x40, 0x6b, 0x18, 0xd1, 0x0d, 0x6b, 0x46, 0x8c, 0x63, 0x1b, 0xf9,
+	0xad, 0x6a, 0xb4, 0x92, 0x74, 0xe6, 0x1d, 0x6f, 0xc6, 0xff, 0x00, 0x17, 0xff, 0xd9, 0x38, 0x42,
+	0x49, 0x4d, 0x04, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x0f, 0x00, 0x41, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00,
+	0x50, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x73, 0x00, 0x68, 0x00, 0x6f, 0x00,
+	0x70, 0x00, 0x00, 0x00, 0x12, 0x00, 0x41, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x65, 0x00,
+	0x20, 0x00, 0x50, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x73, 0x00, 0x68, 0x00,
+	0x6f, 0x00, 0x70, 0x00, 0x20, 0x00, 0x43, 0x00, 0x43, 0x00, 0x00, 0x00, 0x01, 0x00, 0x38, 0x42,
+	0x49, 0x4d, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x01, 0x01, 0x00, 0x01,
+	0x01, 0x00, 0xff, 0xe1, 0x0d, 0x03, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+	0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+	0x30, 0x2f, 0x00, 0x3c, 0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x62, 0x65, 0x67,
+	0x69, 0x6e, 0x3d, 0x22, 0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x57, 0x35, 0x4d,
+	0x30, 0x4d, 0x70, 0x43, 0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53, 0x7a, 0x4e, 0x54, 0x63,
+	0x7a, 0x6b, 0x63, 0x39, 0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x6d,
+	0x65, 0x74, 0x61, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d, 0x22, 0x61, 0x64, 0x6f,
+	0x62, 0x65, 0x3a, 0x6e, 0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22, 0x20, 0x78, 0x3a, 0x78,
+	0x6d, 0x70, 0x74, 0x6b, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x58, 0x4d, 0x50, 0x20,
+	0x43, 0x6f, 0x72, 0x65, 0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34, 0x32, 0x20, 0x37, 0x39,
+	0x2e, 0x31, 0x36, 0x30, 0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31, 0x37, 0x2f, 0x30, 0x37,
+	0x2f, 0x31, 0x33, 0x2d, 0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46, 0x20,
+	0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+	0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x31, 0x39, 0x39,
+	0x39, 0x2f, 0x30, 0x32, 0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d, 0x73, 0x79, 0x6e, 0x74,
+	0x61, 0x78, 0x2d, 0x6e, 0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x44, 0x65,
+	0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64, 0x66, 0x3a, 0x61, 0x62,
+	0x6f, 0x75, 0x74, 0x3d, 0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70,
+	0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+	0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22, 0x20,
+	0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64, 0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+	0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c, 0x65,
+	0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31, 0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+	0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+	0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+	0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+	0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3d, 0x22, 0x68, 0x74,
+	0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+	0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d, 0x2f, 0x22, 0x20, 0x78,
+	0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70,
+	0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f,
+	0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65, 0x2f, 0x52, 0x65,
+	0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23, 0x22, 0x20, 0x78, 0x6d,
+	0x70, 0x3a, 0x4d, 0x6f, 0x64, 0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+	0x32, 0x31, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x35, 0x54, 0x32, 0x30, 0x3a, 0x35, 0x33, 0x3a, 0x30,
+	0x31, 0x2d, 0x30, 0x38, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+	0x61, 0x74, 0x6f, 0x72, 0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+	0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x28, 0x57, 0x69,
+	0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65, 0x61,
+	0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30, 0x32, 0x31, 0x2d, 0x31, 0x32, 0x2d,
+	0x30, 0x35, 0x54, 0x32, 0x30, 0x3a, 0x33, 0x34, 0x3a, 0x34, 0x30, 0x2d, 0x30, 0x38, 0x3a, 0x30,
+	0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61, 0x44,
+	0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30, 0x32, 0x31, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x35, 0x54,
+	0x32, 0x30, 0x3a, 0x35, 0x33, 0x3a, 0x30, 0x31, 0x2d, 0x30, 0x38, 0x3a, 0x30, 0x30, 0x22, 0x20,
+	0x64, 0x63, 0x3a, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69, 0x6d, 0x61, 0x67, 0x65,
+	0x2f, 0x6a, 0x70, 0x65, 0x67, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70,
+	0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x22, 0x20, 0x78,
+	0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3d,
+	0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69, 0x64, 0x3a, 0x65, 0x32, 0x30, 0x37, 0x64, 0x31, 0x37,
+	0x62, 0x2d, 0x30, 0x34, 0x37, 0x63, 0x2d, 0x32, 0x32, 0x34, 0x64, 0x2d, 0x61, 0x33, 0x32, 0x31,
+	0x2d, 0x61, 0x31, 0x64, 0x38, 0x33, 0x38, 0x38, 0x37, 0x61, 0x38, 0x62, 0x38, 0x22, 0x20, 0x78,
+	0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44, 0x3d,
+	0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69, 0x64, 0x3a, 0x65, 0x32, 0x30, 0x37, 0x64, 0x31, 0x37,
+	0x62, 0x2d, 0x30, 0x34, 0x37, 0x63, 0x2d, 0x32, 0x32, 0x34, 0x64, 0x2d, 0x61, 0x33, 0x32, 0x31,
+	0x2d, 0x61, 0x31, 0x64, 0x38, 0x33, 0x38, 0x38, 0x37, 0x61, 0x38, 0x62, 0x38, 0x22, 0x20, 0x78,
+	0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f, 0x63,
+	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69, 0x64,
+	0x3a, 0x65, 0x32, 0x30, 0x37, 0x64, 0x31, 0x37, 0x62, 0x2d, 0x30, 0x34, 0x37, 0x63, 0x2d, 0x32,
+	0x32, 0x34, 0x64, 0x2d, 0x61, 0x33, 0x32, 0x31, 0x2d, 0x61, 0x31, 0x64, 0x38, 0x33, 0x38, 0x38,
+	0x37, 0x61, 0x38, 0x62, 0x38, 0x22, 0x3e, 0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48,
+	0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65, 0x71,
+	0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+	0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20, 0x73,
+	0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3d,
+	0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69, 0x64, 0x3a, 0x65, 0x32, 0x30, 0x37, 0x64, 0x31, 0x37,
+	0x62, 0x2d, 0x30, 0x34, 0x37, 0x63, 0x2d, 0x32, 0x32, 0x34, 0x64, 0x2d, 0x61, 0x33, 0x32, 0x31,
+	0x2d, 0x61, 0x31, 0x64, 0x38, 0x33, 0x38, 0x38, 0x37, 0x61, 0x38, 0x62, 0x38, 0x22, 0x20, 0x73,
+	0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x32, 0x31, 0x2d,
+	0x31, 0x32, 0x2d, 0x30, 0x35, 0x54, 0x32, 0x30, 0x3a, 0x35, 0x33, 0x3a, 0x30, 0x31, 0x2d, 0x30,
+	0x38, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66, 0x74,
+	0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65,
+	0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x28, 0x57,
+	0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x63,
+	0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72,
+	0x64, 0x66, 0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+	0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a, 0x44,
+	0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+	0x66, 0x3a, 0x52, 0x44, 0x46, 0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x6d, 0x65,
+	0x74, 0x61, 0x3e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x65, 0x6e,
+	0x64, 0x3d, 0x22, 0x77, 0x22, 0x3f, 0x3e, 0xff, 0xee, 0x00, 0x21, 0x41, 0x64, 0x6f, 0x62, 0x65,
+	0x00, 0x64, 0x40, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x10, 0x03, 0x02, 0x03, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x84, 0x00, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0xff, 0xc2, 0x00, 0x11, 0x08, 0x00, 0x2d, 0x00, 0x2d, 0x03, 0x01, 0x11, 0x00, 0x02, 0x11, 0x01,
+	0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x07, 0x09, 0x0a, 0x02, 0x03,
+	0x08, 0x01, 0x01, 0x00, 0x01, 0x03, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x07, 0x03, 0x04, 0x06, 0x08, 0x09, 0x05, 0x0a, 0x10, 0x00,
+	0x00, 0x04, 0x05, 0x04, 0x01, 0x04, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0x06, 0x07, 0x08, 0x01, 0x03, 0x04, 0x05, 0x09, 0x00, 0x10, 0x11, 0x12, 0x15, 0x20, 0x21, 0x13,
+	0x14, 0x41, 0x22, 0x17, 0x16, 0x11, 0x00, 0x00, 0x05, 0x03, 0x02, 0x04, 0x02, 0x07, 0x05, 0x09,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x11, 0x06, 0x07, 0x00, 0x12,
+	0x21, 0x31, 0x13, 0x08, 0x41, 0x51, 0x61, 0x71, 0x81, 0x32, 0x14, 0x15, 0x16, 0x10, 0x22, 0x42,
+	0x23, 0x17, 0x91, 0xa1, 0xb1, 0xc1, 0xe1, 0x62, 0x33, 0x24, 0x35, 0x12, 0x00, 0x01, 0x03, 0x02,
+	0x03, 0x05, 0x04, 0x05, 0x08, 0x0a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x02, 0x03,
+	0x12, 0x04, 0x00, 0x21, 0x05, 0x31, 0x41, 0x61, 0x13, 0x06, 0x10, 0x51, 0x22, 0x07, 0x71, 0x81,
+	0xd1, 0x14, 0x15, 0x20, 0xf0, 0xb1, 0x42, 0x52, 0x23, 0x73, 0x83, 0xa1, 0xc1, 0x32, 0x62, 0xd2,
+	0x53, 0x63, 0x34, 0x44, 0x54, 0x64, 0x75, 0x16, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x01, 0x02,
+	0x11, 0x03, 0x11, 0x00, 0x00, 0x00, 0xbf, 0xc0, 0x00, 0xd0, 0x2b, 0x68, 0xda, 0x4b, 0x47, 0x3c,
+	0xf4, 0x56, 0xe5, 0x88, 0x8c, 0x73, 0x88, 0x11, 0x2a, 0xdf, 0x02, 0xf5, 0xee, 0x64, 0xe5, 0x4e,
+	0x7d, 0x4b, 0xb6, 0x4f, 0x04, 0xd6, 0xc6, 0x1b, 0xe9, 0xf4, 0x63, 0x45, 0x3b, 0xde, 0x83, 0x65,
+	0xe3, 0x0f, 0xe5, 0x48, 0x1c, 0xd9, 0x8f, 0xcb, 0x17, 0xce, 0xde, 0x1f, 0x96, 0x54, 0x3f, 0x8d,
+	0x26, 0xf2, 0x5e, 0x39, 0x34, 0x26, 0x19, 0x73, 0x13, 0x31, 0xa6, 0xf0, 0x16, 0xd2, 0xbc, 0xb9,
+	0xfe, 0xd0, 0xf0, 0x65, 0xe8, 0x2a, 0xe0, 0x04, 0xe2, 0x41, 0xbc, 0x79, 0xb9, 0xd2, 0xd1, 0x20,
+	0x69, 0xdb, 0xf8, 0xfb, 0x6c, 0xc0, 0x07, 0x80, 0x56, 0x21, 0x8a, 0x2e, 0xc5, 0x3f, 0xff, 0xda,
+	0x00, 0x08, 0x01, 0x02, 0x00, 0x01, 0x05, 0x00, 0xdb, 0xaf, 0x7d, 0x43, 0xb4, 0x76, 0xfc, 0x84,
+	0x40, 0x88, 0x79, 0xe7, 0x42, 0x88, 0x82, 0x05, 0x7e, 0xfa, 0x72, 0xb1, 0x5f, 0x09, 0xc6, 0xca,
+	0x13, 0x95, 0x8b, 0xb0, 0x3a, 0x2a, 0x67, 0x83, 0x21, 0x5e, 0xec, 0x35, 0x88, 0xf9, 0xc4, 0x16,
+	0x33, 0xef, 0x37, 0x65, 0x34, 0xd9, 0x7b, 0xa0, 0x29, 0x1b, 0xee, 0x04, 0xcb, 0xdf, 0x97, 0x91,
+	0xe2, 0x2f, 0xc4, 0xab, 0x01, 0x9a, 0x6c, 0x51, 0xf2, 0x30, 0xb5, 0x14, 0x70, 0x85, 0x0d, 0x28,
+	0xa5, 0x74, 0xf0, 0x99, 0x46, 0x92, 0xa7, 0x53, 0x6e, 0xb3, 0xb9, 0x1f, 0x3b, 0x7e, 0xba, 0x36,
+	0xa6, 0xd6, 0x43, 0x55, 0xf2, 0x5c, 0xb9, 0x72, 0x25, 0xf1, 0xeb, 0xff, 0xda, 0x00, 0x08, 0x01,
+	0x03, 0x00, 0x01, 0x05, 0x00, 0xda, 0x01, 0xec, 0x21, 0x0e, 0x50, 0x34, 0x1e, 0x78, 0xd4, 0x23,
+	0xcc, 0x7a, 0x8e, 0x3a, 0xe8, 0x2e, 0x31, 0xd6, 0x93, 0x36, 0xf5, 0x85, 0x35, 0x71, 0x88, 0x01,
+	0xc5, 0xb8, 0x29, 0x9f, 0x1c, 0xce, 0xcc, 0x31, 0xae, 0xa3, 0x2b, 0xb1, 0x0a, 0x56, 0x3a, 0xda,
+	0x78, 0xa3, 0x2f, 0x1c, 0x8d, 0x34, 0x71, 0x4f, 0x58, 0xeb, 0x75, 0x4b, 0x8d, 0xce, 0x35, 0xbe,
+	0x94, 0x1c, 0x8a, 0x73, 0x02, 0x05, 0xdf, 0xfa, 0x52, 0x36, 0xe8, 0x96, 0x24, 0x0e, 0xd0, 0x0c,
+	0x90, 0xba, 0xd9, 0x70, 0x0e, 0x4a, 0xdd, 0x8c, 0x22, 0xca, 0xd7, 0x07, 0x8a, 0xe4, 0x8d, 0x79,
+	0x08, 0x79, 0xf2, 0x88, 0xd6, 0xdf, 0xae, 0x0f, 0xad, 0xb7, 0x3a, 0x40, 0x5e, 0xd2, 0x9c, 0xdf,
+	0xd3, 0x4a, 0xda, 0xba, 0xab, 0x8d, 0x77, 0xa6, 0x3b, 0x7f, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01,
+	0x00, 0x01, 0x05, 0x00, 0xda, 0xa0, 0x61, 0x96, 0x0a, 0xb5, 0x12, 0xdf, 0x26, 0xa6, 0xc9, 0x7b,
+	0xa2, 0xbd, 0xd2, 0xfe, 0x2f, 0xea, 0x4d, 0x84, 0xbb, 0xaf, 0xef, 0xe4, 0x7d, 0x19, 0x5c, 0x09,
+	0x2f, 0xc3, 0x65, 0xad, 0xc9, 0xba, 0xe4, 0xd1, 0x6a, 0x60, 0x6f, 0xb4, 0x94, 0xe3, 0xd2, 0xff,
+	0x00, 0x3b, 0x47, 0xe3, 0x32, 0x36, 0xec, 0xd6, 0xc4, 0x6d, 0x44, 0xb8, 0xe4, 0x6d, 0xd9, 0xc8,
+	0x8d, 0xd3, 0x27, 0x0f, 0x1a, 0x9a, 0x2a, 0xbe, 0x42, 0x9d, 0x12, 0xa2, 0x97, 0xb6, 0x17, 0x5a,
+	0xa1, 0xb3, 0x75, 0x8c, 0x2b, 0x79, 0x6a, 0x2c, 0xcd, 0xce, 0x30, 0x44, 0x6d, 0xc0, 0x99, 0x67,
+	0xe2, 0x19, 0xa9, 0x54, 0xea, 0xef, 0x87, 0x76, 0x73, 0x4b, 0x49, 0x90, 0x56, 0xfc, 0xc1, 0x9a,
+	0xba, 0x61, 0x89, 0x4c, 0x6f, 0x81, 0x74, 0xbf, 0xc0, 0xa6, 0x61, 0xff, 0x00, 0x28, 0x29, 0x52,
+	0xc5, 0xaf, 0xad, 0x4f, 0xab, 0xdd, 0xb2, 0x45, 0x75, 0x03, 0xcc, 0xc4, 0xaa, 0x48, 0xef, 0x17,
+	0x94, 0xb1, 0x2e, 0xb6, 0x96, 0x29, 0xfa, 0xc3, 0xa6, 0xde, 0xda, 0x1f, 0x8c, 0xf9, 0x81, 0xf1,
+	0xf5, 0xf6, 0xe3, 0xff, 0xda, 0x00, 0x08, 0x01, 0x02, 0x02, 0x06, 0x3f, 0x00, 0xec, 0xa5, 0x50,
+	0x7c, 0xf2, 0xc1, 0x20, 0x8f, 0x10, 0x46, 0xb4, 0xe4, 0x4a, 0x6f, 0x27, 0xb9, 0x72, 0xe3, 0x8f,
+	0x13, 0x51, 0xfb, 0xfd, 0x5d, 0xdd, 0x95, 0x02, 0x40, 0x54, 0x52, 0x10, 0x1f, 0xa7, 0x1e, 0x19,
+	0x19, 0xeb, 0x27, 0xd9, 0x87, 0xbe, 0xb6, 0x10, 0x37, 0x02, 0x57, 0x8a, 0x65, 0x8d, 0x0e, 0xf6,
+	0xc2, 0x4e, 0x5e, 0x85, 0x1d, 0x2e, 0x80, 0xb7, 0x36, 0x49, 0x27, 0xd6, 0x6c, 0xc4, 0x8f, 0x08,
+	0x23, 0x60, 0xd8, 0x8b, 0xfb, 0xc3, 0x11, 0xea, 0xb6, 0x24, 0x73, 0x40, 0xa6, 0x76, 0x02, 0xae,
+	0x8e, 0x5e, 0x03, 0x69, 0x69, 0x3b, 0x0f, 0xa8, 0xe7, 0x8e, 0x6d, 0x47, 0x62, 0x26, 0xf5, 0xf6,
+	0xaf, 0xab, 0x8e, 0x34, 0xcb, 0x4d, 0x1e, 0xf1, 0xb1, 0x36, 0x5b, 0x5e, 0x63, 0x85, 0x0d, 0x7e,
+	0x75, 0x16, 0xa6, 0x7b, 0x00, 0x1f, 0x46, 0x02, 0xea, 0x8c, 0x3f, 0x90, 0xcf, 0x66, 0x0b, 0x86,
+	0xa7, 0x18, 0x23, 0xfa, 0x0d, 0xf6, 0x62, 0xe7, 0x48, 0xd5, 0x6e, 0xa1, 0x93, 0x4e, 0x95, 0x84,
+	0x39, 0xa6, 0x26, 0x36, 0x82, 0xa0, 0xd4, 0xc2, 0x99, 0x39, 0x73, 0x1c, 0x71, 0x0e, 0xa9, 0x68,
+	0xf2, 0x60, 0x25, 0xad, 0x7c, 0x60, 0x14, 0x95, 0x9d, 0xc8, 0x3e, 0xbf, 0xd9, 0x23, 0x7e, 0x3e,
+	0x3a, 0x60, 0x9b, 0xdd, 0xb9, 0x1c, 0xfa, 0x29, 0xfb, 0xd4, 0xa5, 0x4b, 0x69, 0xd9, 0xb5, 0x33,
+	0xd8, 0x8a, 0x71, 0x6d, 0x73, 0xac, 0xc7, 0x23, 0xee, 0x62, 0x8c, 0xb0, 0x52, 0xea, 0x40, 0x0a,
+	0xa9, 0x96, 0xdf, 0x9e, 0x58, 0x35, 0x59, 0xcc, 0x9f, 0x88, 0x71, 0xfd, 0xa4, 0xe3, 0xf3, 0x5d,
+	0x81, 0x6f, 0x6d, 0x67, 0x24, 0xba, 0xe4, 0xec, 0x34, 0x34, 0xc8, 0xe2, 0x23, 0x61, 0x20, 0x3a,
+	0x49, 0x72, 0xc8, 0x0d, 0xdb, 0x54, 0xfa, 0x31, 0x17, 0x55, 0xf5, 0x05, 0xba, 0x69, 0xb1, 0x1f,
+	0xb8, 0x89, 0xdb, 0x24, 0x70, 0x39, 0x3d, 0x37, 0xb0, 0x6d, 0x1d, 0xf9, 0xaa, 0x21, 0x05, 0x6b,
+	0x15, 0xd4, 0xaa, 0x99, 0x27, 0xd9, 0x4f, 0xb2, 0x9f, 0xa3, 0xb7, 0xc6, 0x15, 0xbd, 0xd8, 0xd2,
+	0xb5, 0x9b, 0x97, 0xb9, 0xb3, 0x42, 0xe1, 0xce, 0x4c, 0x9b, 0x34, 0x60, 0xe4, 0xce, 0x29, 0xb0,
+	0xa2, 0x65, 0xc7, 0x11, 0x5b, 0xdb, 0xb6, 0x9b, 0x78, 0xc5, 0x2d, 0x6a, 0x23, 0x5a, 0xc0, 0x11,
+	0xa1, 0xa3, 0x86, 0xfc, 0x27, 0xcb, 0xff, 0xda, 0x00, 0x08, 0x01, 0x03, 0x02, 0x06, 0x3f, 0x00,
+	0xec, 0x6f, 0x85, 0x7f, 0x56, 0x5b, 0x70, 0x2a, 0x78, 0x69, 0x22, 0xa0, 0x80, 0x94, 0xcd, 0x3c,
+	0x79, 0x64, 0x37, 0xfa, 0x33, 0xc3, 0x8a, 0x82, 0x03, 0x93, 0x2d, 0x83, 0x7a, 0xfa, 0x0e, 0xee,
+	0xc4, 0x07, 0x24, 0x04, 0x1d, 0xc4, 0x1e, 0xec, 0x78, 0x5a, 0xa7, 0xd3, 0x82, 0x65, 0x8f, 0xee,
+	0xda, 0x14, 0xa1, 0xd9, 0xc4, 0x81, 0x9d, 0x3d, 0xfc, 0x31, 0xe6, 0x8f, 0x46, 0x75, 0x7d, 0xa7,
+	0xbe, 0x79, 0xa1, 0x7d, 0x1f, 0x2b, 0x50, 0x12, 0x06, 0xf3, 0x2d, 0x6c, 0x00, 0x70, 0xb7, 0xb9,
+	0xd2, 0x80, 0x2d, 0x2e, 0x0c, 0x79, 0x06, 0x72, 0x6b, 0x78, 0x71, 0x63, 0x88, 0xca, 0x32, 0x6f,
+	0xfa, 0x13, 0xa9, 0xa2, 0xe7, 0x69, 0x8f, 0x0e, 0x97, 0x4d, 0xbc, 0xa6, 0x98, 0xef, 0xad, 0x02,
+	0x21, 0x0e, 0xcd, 0xad, 0x9e, 0x36, 0x90, 0x25, 0x61, 0x2a, 0xa8, 0x42, 0xb4, 0x87, 0x1a, 0x69,
+	0x75, 0x1e, 0x91, 0x57, 0x7a, 0x7a, 0x71, 0xd7, 0xfd, 0x47, 0xe6, 0x56, 0x8f, 0x73, 0x77, 0xa9,
+	0x58, 0xeb, 0xac, 0xb4, 0x85, 0xf1, 0xdc, 0xcd, 0x6c, 0x04, 0x66, 0xd8, 0x4a, 0xe6, 0xa4, 0x6e,
+	0x01, 0xc4, 0x3c, 0xa0, 0x5c, 0xc0, 0xe0, 0x98, 0xf1, 0xf4, 0x8d, 0xf1, 0x1f, 0xf6, 0x77, 0x3f,
+	0xc7, 0x84, 0x67, 0x48, 0x5f, 0x07, 0x1c, 0x97, 0xe2, 0x97, 0x03, 0x24, 0x43, 0xb6, 0x44, 0x23,
+	0x72, 0x71, 0xc6, 0x85, 0xd7, 0x9d, 0x0f, 0xa3, 0xea, 0x56, 0x3d, 0x4b, 0xa6, 0x4e, 0xd9, 0x22,
+	0x92, 0x3d, 0x52, 0xe1, 0xf9, 0x37, 0x23, 0x1b, 0xa3, 0xac, 0xb6, 0x48, 0xdc, 0xa8, 0xe6, 0xbc,
+	0x50, 0x84, 0x87, 0x6d, 0xc5, 0xff, 0x00, 0x97, 0xdd, 0x53, 0x03, 0x22, 0xbd, 0x68, 0x92, 0x5b,
+	0x0b, 0xc4, 0x6b, 0xa4, 0xb1, 0xb8, 0x2a, 0xf6, 0xca, 0xe9, 0x9e, 0x80, 0x44, 0x4a, 0xf3, 0x5a,
+	0x5c, 0x1a, 0x1a, 0x48, 0x56, 0xaa, 0x87, 0x79, 0x59, 0xf1, 0x3d, 0x3f, 0xe3, 0x9f, 0x18, 0x1a,
+	0x67, 0xbd, 0x73, 0x8f, 0xba, 0x73, 0x2b, 0x31, 0x0b, 0x81, 0x22, 0xaa, 0x50, 0xaf, 0x2c, 0xdb,
+	0x52, 0x31, 0x2a, 0xc6, 0xb3, 0xa0, 0x79, 0x6d, 0xad, 0x5a, 0xc1, 0xa5, 0xdf, 0xdd, 0x36, 0xea,
+	0x61, 0x35, 0xbb, 0x65, 0x26, 0x71, 0x18, 0x89, 0x45, 0x47, 0xc2, 0x28, 0x09, 0x96, 0xdd, 0xf8,
+	0x14, 0x75, 0x56, 0x9a, 0xa3, 0xfe, 0x0c, 0x5e, 0xdc, 0x01, 0xff, 0x00, 0xa8, 0xd2, 0xcf, 0xa6,
+	0xc2, 0x2d, 0xd9, 0xf7, 0xe1, 0xba, 0xce, 0xbf, 0xd4, 0xb6, 0x96, 0x9e, 0x53, 0x69, 0xb7, 0x2c,
+	0x37, 0x73, 0xb2, 0xc2, 0x26, 0xba, 0xf6, 0x4f, 0xf4, 0x6d, 0x8a, 0xab, 0x9c, 0xf5, 0x1c, 0xe7,
+	0x04, 0xe5, 0x34, 0x05, 0xcd, 0xc0, 0xe3, 0x54, 0xf2, 0x03, 0xca, 0x7d, 0x5e, 0x9e, 0xb1, 0xba,
+	0x8d, 0xcd, 0xd5, 0x6e, 0xe1, 0x78, 0x77, 0xb8, 0xc1, 0x27, 0xf8, 0xd1, 0xbf, 0xfd, 0x99, 0x1b,
+	0x9b, 0xff, 0x00, 0x96, 0x10, 0xb4, 0x92, 0x5a, 0xe6, 0xfb, 0xaf, 0x31, 0xd4, 0xd3, 0x4f, 0x33,
+	0xeb, 0xec, 0x5e, 0x77, 0xe2, 0xd5, 0x9a, 0xaf, 0xaf, 0xb6, 0x95, 0xfd, 0xac, 0xb8, 0x1d, 0xe8,
+	0x4e, 0xe1, 0xc7, 0x1d, 0x71, 0xe5, 0xbf, 0x4d, 0xc1, 0x05, 0xd6, 0x97, 0x7e, 0xd7, 0xbb, 0x4d,
+	0x96, 0x60, 0x92, 0x69, 0x77, 0x32, 0x82, 0xd9, 0x65, 0x6b, 0x51, 0x1e, 0xd2, 0x1c, 0x5c, 0xd5,
+	0x0e, 0x6d, 0x6d, 0x05, 0x05, 0x4f, 0x26, 0xf3, 0x52, 0xbf, 0xba, 0x7c, 0xfa, 0x8d, 0xc4, 0x8e,
+	0x92, 0x69, 0x64, 0x71, 0x7c, 0x92, 0xc8, 0xf2, 0x5c, 0xe9, 0x9e, 0xf2, 0x49, 0x2f, 0x7b, 0x89,
+	0xa9, 0xa4, 0x92, 0x06, 0xdf, 0x91, 0x9e, 0x33, 0xc1, 0x5e, 0xcf, 0xff, 0xda, 0x00, 0x08, 0x01,
+	0x01, 0x01, 0x06, 0x3f, 0x00, 0xfb, 0x37, 0x9f, 0xdd, 0x28, 0xf1, 0xe1, 0xc0, 0x2b, 0xe2, 0x23,
+	0xe0, 0x14, 0xd3, 0xb4, 0x90, 0x4d, 0x77, 0x29, 0x30, 0x31, 0x41, 0xeb, 0x86, 0xe8, 0x2c, 0xab,
+	0x64, 0x37, 0x9c, 0x08, 0x40, 0x59, 0x74, 0xc8, 0x64, 0x5b, 0x75, 0x14, 0x1d, 0xa5, 0x32, 0xa6,
+	0x4c, 0x86, 0x3f, 0xdd, 0x28, 0x88, 0x80, 0xd1, 0x37, 0x6c, 0x95, 0x4d, 0x44, 0x95, 0x28, 0x18,
+	0xa2, 0x41, 0x01, 0x10, 0x1e, 0x5b, 0x47, 0x90, 0x88, 0x80, 0xf3, 0xf4, 0xeb, 0xd9, 0xa3, 0x7c,
+	0x7b, 0xa2, 0xa2, 0x50, 0x13, 0x94, 0x15, 0x52, 0x80, 0x98, 0x9d, 0x31, 0x12, 0x9c, 0xa0, 0x6e,
+	0x42, 0x24, 0x30, 0x50, 0x7c, 0x87, 0x86, 0xbf, 0xec, 0x34, 0xf2, 0x1a, 0x1c, 0x83, 0xc7, 0xd8,
+	0x3a, 0x7a, 0x09, 0x4b, 0xb3, 0xea, 0x74, 0x4d, 0xbb, 0x6a, 0xc5, 0x01, 0x02, 0x87, 0xbe, 0x20,
+	0x22, 0x60, 0xa1, 0x81, 0x3a, 0x88, 0x52, 0x83, 0xba, 0x9a, 0xed, 0xd7, 0x2f, 0xe2, 0x1b, 0xd9,
+	0xa5, 0xbb, 0xdb, 0xcd, 0xa8, 0xfb, 0xe6, 0xf8, 0x36, 0x76, 0xd2, 0x70, 0xa4, 0x9c, 0x0c, 0xe6,
+	0x7b, 0x6f, 0x0e, 0x54, 0x72, 0xd5, 0x9f, 0xdc, 0x4c, 0x4f, 0x50, 0x84, 0x91, 0xb8, 0xdd, 0x45,
+	0x99, 0x58, 0xf8, 0xb8, 0x57, 0x21, 0xf2, 0xd7, 0x56, 0x92, 0xeb, 0x2a, 0xc4, 0xc6, 0x78, 0x77,
+	0x66, 0x4e, 0x37, 0x28, 0xda, 0x45, 0x08, 0x46, 0xa5, 0x91, 0x65, 0x6c, 0xe5, 0xdc, 0x66, 0xe1,
+	0xf1, 0x9e, 0x4a, 0xe1, 0x3c, 0x9c, 0xe9, 0x13, 0x38, 0x56, 0x09, 0x55, 0xd7, 0x30, 0x2b, 0x29,
+	0x60, 0x5d, 0x49, 0xa6, 0x77, 0x96, 0xcc, 0xb8, 0x07, 0x4d, 0xdb, 0x30, 0x33, 0x75, 0x04, 0xaf,
+	0x1b, 0x2e, 0x98, 0x0c, 0x97, 0x58, 0x3e, 0x1b, 0xa0, 0x0a, 0xf5, 0x2a, 0x1c, 0xb6, 0x0a, 0x95,
+	0xa7, 0x2e, 0x5e, 0xca, 0x71, 0xd6, 0x30, 0x8a, 0xc7, 0x2e, 0xec, 0x46, 0x91, 0xb7, 0x6e, 0x38,
+	0xba, 0x6e, 0x39, 0xb4, 0xee, 0xcc, 0x67, 0x6e, 0xdf, 0x0e, 0xdc, 0x4b, 0x46, 0xe4, 0xb9, 0x5b,
+	0x71, 0x99, 0x93, 0x7d, 0x3a, 0x26, 0x55, 0xab, 0x64, 0x22, 0x1a, 0x11, 0x20, 0x44, 0x80, 0x04,
+	0x11, 0x0d, 0xdc, 0xeb, 0xa1, 0x2a, 0x32, 0x98, 0x48, 0x81, 0x51, 0x10, 0xaf, 0x6e, 0x38, 0xe8,
+	0xf4, 0x0e, 0x7c, 0xcc, 0x9f, 0x1a, 0x57, 0x46, 0x22, 0x73, 0x78, 0x32, 0x82, 0x34, 0xa1, 0xbb,
+	0x6a, 0xc6, 0xa6, 0x0a, 0xf9, 0x88, 0x19, 0x2a, 0x08, 0xd0, 0x3d, 0x5a, 0xbd, 0x70, 0xd5, 0xf0,
+	0xe7, 0x06, 0xc8, 0x63, 0x3c, 0x82, 0x76, 0xea, 0xdd, 0xb6, 0xe4, 0x47, 0x6e, 0xb8, 0xea, 0xd9,
+	0x59, 0xf4, 0x9c, 0x68, 0x10, 0xf0, 0xf7, 0x2b, 0x39, 0xb8, 0x64, 0x9b, 0xc9, 0xc4, 0xdd, 0xb6,
+	0xfa, 0xa8, 0x90, 0xf1, 0xf2, 0x48, 0x1c, 0x1c, 0x34, 0x3a, 0x60, 0x25, 0x11, 0x0a, 0x80, 0xc4,
+	0xe6, 0x3b, 0x18, 0xe8, 0xcc, 0xb0, 0x23, 0x23, 0x40, 0xe4, 0xbc, 0x7f, 0x32, 0xf0, 0xed, 0x2d,
+	0x8c, 0xaf, 0x8e, 0x96, 0x58, 0xae, 0xa6, 0x6d, 0x0b, 0x99, 0x42, 0x91, 0x64, 0xd9, 0x39, 0x48,
+	0xe9, 0x03, 0xd8, 0xa9, 0x32, 0xa6, 0x65, 0xa2, 0x65, 0x12, 0x49, 0x72, 0x01, 0x8b, 0xd4, 0x21,
+	0xd7, 0xee, 0x0b, 0xe5, 0x59, 0x67, 0xf4, 0xdc, 0x98, 0x91, 0xae, 0x6d, 0xfa, 0x48, 0x6d, 0x07,
+	0xc1, 0x99, 0xc2, 0xc9, 0x56, 0xd6, 0x79, 0x73, 0x7d, 0x28, 0x5b, 0x4c, 0x47, 0xe2, 0x8f, 0x76,
+	0x0b, 0x04, 0xba, 0x43, 0x41, 0x16, 0xe5, 0x00, 0x07, 0x62, 0x20, 0xd0, 0xc5, 0x11, 0x82, 0xb9,
+	0x72, 0x5d, 0x8b, 0x72, 0xdc, 0xd2, 0x76, 0xa4, 0x1c, 0xad, 0xb3, 0x02, 0xb5, 0xbf, 0x93, 0xae,
+	0xeb, 0x14, 0xa9, 0x42, 0x4a, 0xcf, 0xb8, 0xba, 0x1c, 0xb5, 0x78, 0xc2, 0x05, 0x92, 0xf1, 0xef,
+	0x17, 0x4a, 0x59, 0xd9, 0xf6, 0x38, 0xa8, 0x2a, 0x29, 0x08, 0x14, 0xdc, 0xb5, 0x45, 0xb0, 0x86,
+	0x50, 0x1a, 0x8d, 0x44, 0x49, 0xdc, 0xa6, 0x48, 0x20, 0xd7, 0xcc, 0x04, 0x22, 0x43, 0x80, 0x79,
+	0x69, 0xd3, 0xc7, 0x58, 0x37, 0x2c, 0x28, 0x54, 0x93, 0x15, 0x0c, 0x92, 0x7d, 0xcd, 0xe4, 0xa2,
+	0x9d, 0x4e, 0x7f, 0x96, 0x5d, 0xd1, 0x1b, 0x77, 0x18, 0x78, 0x00, 0x79, 0x8e, 0x91, 0x80, 0xb7,
+	0xb0, 0xad, 0xfb, 0x17, 0xdc, 0xfe, 0x48, 0x22, 0xee, 0x71, 0x95, 0xab, 0x2b, 0xdc, 0x7d, 0xf3,
+	0x7a, 0xc6, 0xd8, 0xf6, 0x0a, 0x67, 0x2b, 0x57, 0x19, 0xab, 0x23, 0xc1, 0xa8, 0xd2, 0x35, 0x06,
+	0x6d, 0xdf, 0x48, 0x11, 0x56, 0xb6, 0xe4, 0x32, 0xc7, 0x39, 0xa6, 0xd6, 0x29, 0xdc, 0x1c, 0x0a,
+	0xdd, 0x05, 0x37, 0x40, 0x77, 0x51, 0x9d, 0x2d, 0x92, 0xcb, 0xe1, 0x5b, 0x7e, 0x6d, 0x4f, 0xd1,
+	0x4c, 0x75, 0x30, 0xd4, 0x41, 0xbe, 0x76, 0xbe, 0xa0, 0x5e, 0x82, 0x6a, 0xde, 0x57, 0x0b, 0x33,
+	0x82, 0x7f, 0x19, 0x86, 0x2c, 0x19, 0x54, 0x04, 0x0e, 0x9e, 0xde, 0x8d, 0xc5, 0x30, 0x97, 0xc2,
+	0xd4, 0xcd, 0x1b, 0xae, 0x55, 0x0e, 0xbf, 0xcc, 0xd6, 0xfa, 0x9c, 0x56, 0x4e, 0x5c, 0x1f, 0xf1,
+	0xdc, 0x0f, 0x8a, 0x92, 0xa2, 0x29, 0x01, 0x69, 0x40, 0x48, 0x4c, 0x60, 0x28, 0x92, 0x9d, 0x3d,
+	0xa0, 0x09, 0xed, 0xe9, 0xfd, 0xdd, 0x0e, 0xe4, 0xc8, 0x22, 0x3e, 0x22, 0x50, 0x1f, 0x0a, 0x7f,
+	0x0d, 0x7f, 0x88, 0x9f, 0xb3, 0x4e, 0x1a, 0x82, 0x20, 0x02, 0xa1, 0x00, 0x0a, 0x72, 0x80, 0x14,
+	0xc0, 0x25, 0xa9, 0x80, 0x40, 0x40, 0x38, 0x89, 0x4c, 0x00, 0x34, 0x1e, 0x03, 0x4d, 0x63, 0xac,
+	0xcb, 0x75, 0x48, 0xcc, 0xd9, 0x6f, 0xe3, 0xdf, 0x44, 0xc1, 0xe7, 0x78, 0x5b, 0x71, 0xa3, 0xc3,
+	0xb7, 0xcf, 0xf8, 0xe2, 0xd5, 0x8b, 0x14, 0x2d, 0x28, 0x67, 0x33, 0x6d, 0x9c, 0x14, 0xf6, 0x0d,
+	0xcb, 0x1a, 0x46, 0x49, 0xc4, 0x38, 0x99, 0x29, 0x45, 0x47, 0x56, 0xf2, 0xca, 0x37, 0x4f, 0xfd,
+	0xc4, 0xd0, 0x39, 0x63, 0xb6, 0xc3, 0x46, 0xc4, 0x34, 0x87, 0x8a, 0x8e, 0xb7, 0xad, 0x9b, 0x7e,
+	0x22, 0x3d, 0x18, 0xd8, 0x2b, 0x4a, 0xd7, 0x84, 0x6a, 0x9b, 0x08, 0x1b, 0x72, 0x02, 0x29, 0xb0,
+	0x15, 0xb4, 0x54, 0x4c, 0x4c, 0x72, 0x24, 0x45, 0x04, 0x49, 0xee, 0x80, 0x08, 0x88, 0x89, 0xcc,
+	0x63, 0x0e, 0xcf, 0xc3, 0xb6, 0x9e, 0x1c, 0xa9, 0xea, 0xa7, 0xdb, 0xe1, 0xa2, 0x75, 0xba, 0x1d,
+	0x5d, 0xdf, 0x97, 0xd4, 0xdb, 0x5d, 0xdf, 0xdb, 0x4e, 0x1f, 0xd7, 0xd3, 0xa0, 0xe9, 0xd3, 0x6d,
+	0x3f, 0x0f, 0xf3, 0xf4, 0xfa, 0xf5, 0xe8, 0xfd, 0xd4, 0xd7, 0xff, 0xd9,
+};
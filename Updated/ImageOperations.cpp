@@ -9,6 +9,7 @@
 #include <opencv2/features2d.hpp>
 #include <iostream>
 #include <cmath>
+#include <cstring>
 #include <opencv2/core/types.hpp>
 #include <vector>
 #include <stdlib.h>
@@ -16,6 +17,10 @@
 #include <opencv2/videoio.hpp>
 #include <opencv2/video.hpp>
 #include "Hand.h"
+#include "BackgroundModel.h"
+#include "Parallel.h"
+#include "Smoothing.h"
+#include "RunMask.h"
 using namespace cv;
 using namespace std;
 
@@ -34,6 +39,25 @@ int const brightness_level = 40;
 int const number_random_frames = 30;
 int const background_remover_thresh = 20;
 int const red_color_thresh = 190;
+bool const fused_color_adjust = true;
+int const hsv_shift = 12;
+int const contrast_sample_stride = 1;
+int const background_warmup_frames = 30;
+double const background_learning_rate = 0.02;
+int const sample_seek_distance = 30;
+bool const integer_preprocessing = true;	// Fixed point and saturating integer math instead of double
+int const contrast_fraction_bits = 8;		// Contrast and channel means are 8.8 fixed point
+int const average_reciprocal_shift = 24;	// Dividing by a reciprocal is exact for fewer than 256 frames
+SmoothingBackend const smoothing_backend = OPENCV_SMOOTHING;
+int const box_gaussian_passes = 3;
+
+void BackgroundDiffRow(const uchar* front, const uchar* back, uchar* mask, int width,
+	int thresh, int red_thresh);
+void ModifyContrast(Mat& pic, double const contrast, Scalar& running_mean, bool const integer_math);
+void PrepareImage(Mat& image, Scalar& contrast_mean);
+void PrepareImage(Mat& image, Scalar& contrast_mean, int const scale);
+void PrepareImage(Mat& image, Scalar& contrast_mean, int const scale, bool const integer_math,
+	SmoothingBackend smoothing);
 
 
 // FixComputedColor
@@ -51,58 +75,421 @@ int FixComputedColor(double num) {
 	return int(num);
 }
 
+// BandSums
+// Precondition: bands is at least 1
+// Postcondition: Returns bands * 3 zeroed sums for a per band reduction. They belong to the calling
+//                thread and keep their memory, so only the first call with the most bands allocates.
+static int64* BandSums(int const bands) {
+	thread_local vector<int64> sums;
+	sums.assign(bands * 3, 0);
+	return sums.data();
+}
+
+// ChannelMean
+// Precondition: pic is colored and stride is at least 1
+// Postcondition: Returns the average blue, green and red of pic, summed in integers over row bands in
+//                parallel. With a stride above 1 only every stride-th row and column is read, so the
+//                mean is an estimate. An error of e in the mean only moves a contrast output by
+//                |contrast - 1| * e, which keeps it within 1 level for e up to 10 at contrast_num.
+Scalar ChannelMean(const Mat& pic, int const stride) {
+	int const sampled_rows = (pic.rows + stride - 1) / stride;
+	int const sampled_cols = (pic.cols + stride - 1) / stride;
+	int const bands = RowBands(sampled_rows);
+	int64* const band_sums = BandSums(bands);
+
+	ParallelRowBands(sampled_rows, bands, [&](int band, int start_row, int end_row) {
+		int64 sum_blue = 0;
+		int64 sum_green = 0;
+		int64 sum_red = 0;
+		for (int i = start_row; i < end_row; i++) {
+			const uchar* pixel = pic.ptr<uchar>(i * stride);
+			int row_blue = 0;
+			int row_green = 0;
+			int row_red = 0;
+			for (int col = 0; col < sampled_cols; col++, pixel += 3 * stride) {
+				row_blue += pixel[0];
+				row_green += pixel[1];
+				row_red += pixel[2];
+			}
+			sum_blue += row_blue;
+			sum_green += row_green;
+			sum_red += row_red;
+		}
+		band_sums[band * 3] = sum_blue;
+		band_sums[band * 3 + 1] = sum_green;
+		band_sums[band * 3 + 2] = sum_red;
+	});
+
+	Scalar channel_mean;
+	double const count = double(sampled_rows) * sampled_cols;
+	for (int channel = 0; channel < 3; channel++) {
+		int64 total = 0;
+		for (int band = 0; band < bands; band++) {
+			total += band_sums[band * 3 + channel];
+		}
+		channel_mean[channel] = total / count;
+	}
+	return channel_mean;
+}
+
+// ApplyContrastTable
+// Precondition: pic is colored and channel_mean holds the mean the contrast is centred on
+// Postcondition: pic gets the mean centred contrast through one lookup table per channel, applied
+//                over row bands in parallel. Returns the mean of pic from before the contrast, which
+//                is summed in the same pass so the next frame can use it. With integer_math the
+//                tables are worked out with the contrast and the means in 8.8 fixed point, which
+//                moves an output by at most 1 from the double tables.
+Scalar ApplyContrastTable(Mat& pic, const Scalar& channel_mean, double const contrast, bool const integer_math) {
+	uchar channel_lut[3][256];
+	int const contrast_fixed = cvRound(contrast * (1 << contrast_fraction_bits));
+	for (int channel = 0; channel < 3; channel++) {
+		int const mean_fixed = cvRound(channel_mean[channel] * (1 << contrast_fraction_bits));
+		for (int value = 0; value < 256; value++) {
+			if (integer_math) {
+				// The 8.8 difference times the 8.8 contrast is 16.16, so is the mean shifted up to it
+				int const result = (mean_fixed << contrast_fraction_bits) -
+					(mean_fixed - (value << contrast_fraction_bits)) * contrast_fixed;
+				channel_lut[channel][value] = saturate_cast<uchar>(result >> (2 * contrast_fraction_bits));
+			}
+			else {
+				channel_lut[channel][value] =
+					FixComputedColor(channel_mean[channel] - ((channel_mean[channel] - value) * contrast));
+			}
+		}
+	}
+
+	int const bands = RowBands(pic.rows);
+	int64* const band_sums = BandSums(bands);
+	ParallelRowBands(pic.rows, bands, [&](int band, int start_row, int end_row) {
+		int64 sum_blue = 0;
+		int64 sum_green = 0;
+		int64 sum_red = 0;
+		for (int row = start_row; row < end_row; row++) {
+			uchar* pixel = pic.ptr<uchar>(row);
+			int row_blue = 0;
+			int row_green = 0;
+			int row_red = 0;
+			for (int col = 0; col < pic.cols; col++, pixel += 3) {
+				row_blue += pixel[0];
+				row_green += pixel[1];
+				row_red += pixel[2];
+				pixel[0] = channel_lut[0][pixel[0]];
+				pixel[1] = channel_lut[1][pixel[1]];
+				pixel[2] = channel_lut[2][pixel[2]];
+			}
+			sum_blue += row_blue;
+			sum_green += row_green;
+			sum_red += row_red;
+		}
+		band_sums[band * 3] = sum_blue;
+		band_sums[band * 3 + 1] = sum_green;
+		band_sums[band * 3 + 2] = sum_red;
+	});
+
+	Scalar input_mean;
+	for (int channel = 0; channel < 3; channel++) {
+		int64 total = 0;
+		for (int band = 0; band < bands; band++) {
+			total += band_sums[band * 3 + channel];
+		}
+		input_mean[channel] = total / double(pic.total());
+	}
+	return input_mean;
+}
+
 // ModifyContrast
 // Precondition: Parameters are passed in correctly. pic is a colored image.
 // Postcondition: pic will be modified depending on the amount of contrast passed in
 void ModifyContrast(Mat& pic, double const contrast) {
-	double ave_blue = 0;
-	double ave_green = 0;
-	double ave_red = 0;
+	ApplyContrastTable(pic, ChannelMean(pic, contrast_sample_stride), contrast, integer_preprocessing);
+}
+
+// ModifyContrast
+// Precondition: Parameters are passed in correctly. pic is a colored image. running_mean is the
+//               value left by the previous call, or negative to start over.
+// Postcondition: pic will be modified depending on the amount of contrast passed in, centred on the
+//                previous frame's mean so only one pass is made. running_mean is set to pic's mean.
+void ModifyContrast(Mat& pic, double const contrast, Scalar& running_mean) {
+	ModifyContrast(pic, contrast, running_mean, integer_preprocessing);
+}
+
+// ModifyContrast
+// Precondition: Same as ModifyContrast
+// Postcondition: Same as ModifyContrast, with the table worked out in 8.8 fixed point when
+//                integer_math is set and in double otherwise
+void ModifyContrast(Mat& pic, double const contrast, Scalar& running_mean, bool const integer_math) {
+	if (running_mean[0] < 0) {
+		running_mean = ChannelMean(pic, contrast_sample_stride);
+	}
+	running_mean = ApplyContrastTable(pic, running_mean, contrast, integer_math);
+}
+
+// Modifies the saturation in each pixel in the given image, using saturation value in HSV
+// Preconditions: image is colored and of the correct type and correctly allocated
+// Postconditions: given image's saturation is changed by the given amount, clamped with saturating
+//                 integer math when integer_math is set and through FixComputedColor otherwise
+void ModifySaturation(Mat& image, int const saturate, bool const integer_math) {
+	thread_local Mat hsv;	// Kept for the next frame, the rows below use the caller's through saturated
+	Mat& saturated = hsv;
+	cvtColor(image, saturated, COLOR_BGR2HSV);
+	ParallelRows(saturated.rows, [&](int start_row, int end_row) {
+		for (int row = start_row; row < end_row; row++) {
+			uchar* pixel = saturated.ptr<uchar>(row);
+			if (integer_math) {
+				for (int col = 0; col < saturated.cols; col++, pixel += 3) {
+					pixel[1] = saturate_cast<uchar>(pixel[1] + saturate);
+				}
+				continue;
+			}
+			for (int col = 0; col < saturated.cols; col++, pixel += 3) {
+				pixel[1] = FixComputedColor(pixel[1] + saturate);
+			}
+		}
+	});
+	cvtColor(saturated, image, COLOR_HSV2BGR);
+}
+
+// Modifies the saturation in each pixel in the given image, using saturation value in HSV
+// Preconditions: image is colored and of the correct type and correctly allocated
+// Postconditions: given image's saturation is changed by the global constant sat_val amount
+void ModifySaturation(Mat& image, int const saturate) {
+	ModifySaturation(image, saturate, integer_preprocessing);
+}
 
-	for (int row = 0; row < pic.rows; row++) {
-		for (int col = 0; col < pic.cols; col++) {
-			ave_blue += pic.at<Vec3b>(row, col)[0];
-			ave_green += pic.at<Vec3b>(row, col)[1];
-			ave_red += pic.at<Vec3b>(row, col)[2];
+// ApplyBrightnessSaturation
+// Precondition: image is colored
+// Postcondition: image gets the brightness offset and the saturation boost of ModifySaturation in
+//                one pass. The HSV round trip is worked out directly on the BGR values, including
+//                the 2 degree steps of the 8 bit hue, so the result is within 1 of ModifySaturation.
+//                With integer_math the tables are filled without doubles, which gives the same
+//                tables since none of the reciprocals falls exactly halfway.
+void ApplyBrightnessSaturation(Mat& image, int const brightness, int const saturate, bool const integer_math) {
+	uchar bright_lut[256];
+	uchar sat_lut[256];
+	int sat_div[256];
+	int hue_div[256];
+	for (int value = 0; value < 256; value++) {
+		// Same fixed point reciprocals OpenCV uses for S and H in BGR2HSV
+		if (integer_math) {
+			bright_lut[value] = saturate_cast<uchar>(value + brightness);
+			sat_lut[value] = saturate_cast<uchar>(value + saturate);
+			sat_div[value] = (value == 0) ? 0 : ((255 << hsv_shift) + value / 2) / value;
+			hue_div[value] = (value == 0) ? 0 : ((30 << hsv_shift) + value / 2) / value;
+		}
+		else {
+			bright_lut[value] = FixComputedColor(value + brightness);
+			sat_lut[value] = FixComputedColor(value + saturate);
+			sat_div[value] = (value == 0) ? 0 : cvRound((255 << hsv_shift) / double(value));
+			hue_div[value] = (value == 0) ? 0 : cvRound((30 << hsv_shift) / double(value));
 		}
 	}
 
-	ave_blue = ave_blue / pic.total();
-	ave_green = ave_green / pic.total();
-	ave_red = ave_red / pic.total();
+	ParallelRows(image.rows, [&](int start_row, int end_row) {
+		for (int row = start_row; row < end_row; row++) {
+			uchar* pixel = image.ptr<uchar>(row);
+			for (int col = 0; col < image.cols; col++, pixel += 3) {
+				int blue = bright_lut[pixel[0]];
+				int green = bright_lut[pixel[1]];
+				int red = bright_lut[pixel[2]];
+
+				int value = std::max(blue, std::max(green, red));
+				int lowest = std::min(blue, std::min(green, red));
+				int diff = value - lowest;
+				int saturation = (diff * sat_div[value] + (1 << (hsv_shift - 1))) >> hsv_shift;
+
+				int hue;
+				if (value == red) hue = green - blue;
+				else if (value == green) hue = blue - red + 2 * diff;
+				else hue = red - green + 4 * diff;
+				hue = (hue * hue_div[diff] + (1 << (hsv_shift - 1))) >> hsv_shift;
+				if (hue < 0) hue += 180;
+				int sector = hue / 30;
+				int step = hue % 30;
+
+				// V * S is kept scaled by 255 * 30 so the new channels come out with one rounding
+				int boost = value * sat_lut[saturation];
+				int new_lowest = value - (boost * 30 + 3825) / 7650;
+				int falling = value - (boost * step + 3825) / 7650;
+				int rising = value - (boost * (30 - step) + 3825) / 7650;
+
+				if (sector == 0) { pixel[0] = new_lowest; pixel[1] = rising; pixel[2] = value; }
+				else if (sector == 1) { pixel[0] = new_lowest; pixel[1] = value; pixel[2] = falling; }
+				else if (sector == 2) { pixel[0] = rising; pixel[1] = value; pixel[2] = new_lowest; }
+				else if (sector == 3) { pixel[0] = value; pixel[1] = falling; pixel[2] = new_lowest; }
+				else if (sector == 4) { pixel[0] = value; pixel[1] = new_lowest; pixel[2] = rising; }
+				else { pixel[0] = falling; pixel[1] = new_lowest; pixel[2] = value; }
+			}
+		}
+	});
+}
 
-	for (int row = 0; row < pic.rows; row++) {
-		for (int col = 0; col < pic.cols; col++) {
-			double new_blue = ave_blue - double(pic.at<Vec3b>(row, col)[0]);
-			new_blue = ave_blue - (new_blue * contrast);
+// ApplyBrightnessSaturation
+// Precondition: image is colored
+// Postcondition: Same as ApplyBrightnessSaturation, with the tables filled by integer_preprocessing
+void ApplyBrightnessSaturation(Mat& image, int const brightness, int const saturate) {
+	ApplyBrightnessSaturation(image, brightness, saturate, integer_preprocessing);
+}
 
-			double new_green = ave_green - double(pic.at<Vec3b>(row, col)[1]);
-			new_green = ave_green - (new_green * contrast);
+// HistogramMedianRows
+// Precondition: padded is image with radius pixels replicated on every side, output is the size of image
+// Postcondition: Rows start_row to end_row of output hold the median of channel over the window of
+//                2 * radius + 1 pixels around each pixel. One histogram per column is slid down a row at
+//                a time, and the window's histogram is slid along the row by adding and removing whole
+//                column histograms. The 256 bins are split into 16 coarse bins, and only the fine bins
+//                of the coarse bin holding the median are brought up to date. The column histograms
+//                belong to the calling thread and keep their memory from call to call.
+static void HistogramMedianRows(const Mat& padded, Mat& output, int const channel, int const radius,
+	int const start_row, int const end_row) {
+	int const size = 2 * radius + 1;
+	int const rank = size * size / 2;
+	int const padded_cols = padded.cols;
+	thread_local vector<uchar> column_coarse;
+	thread_local vector<uchar> column_fine;
+	column_coarse.assign(padded_cols * 16, 0);
+	column_fine.assign(padded_cols * 256, 0);
 
-			double new_red = ave_red - double(pic.at<Vec3b>(row, col)[2]);
-			new_red = ave_red - (new_red * contrast);
+	// Padded rows start_row to start_row + 2 * radius are the window of the first output row
+	for (int row = start_row; row < start_row + size; row++) {
+		const uchar* pixel = padded.ptr<uchar>(row) + channel;
+		for (int col = 0; col < padded_cols; col++) {
+			column_coarse[col * 16 + (pixel[col * 3] >> 4)]++;
+			column_fine[col * 256 + pixel[col * 3]]++;
+		}
+	}
+
+	for (int row = start_row; row < end_row; row++) {
+		if (row > start_row) {
+			const uchar* leaving = padded.ptr<uchar>(row - 1) + channel;
+			const uchar* entering = padded.ptr<uchar>(row + 2 * radius) + channel;
+			for (int col = 0; col < padded_cols; col++) {
+				column_coarse[col * 16 + (leaving[col * 3] >> 4)]--;
+				column_fine[col * 256 + leaving[col * 3]]--;
+				column_coarse[col * 16 + (entering[col * 3] >> 4)]++;
+				column_fine[col * 256 + entering[col * 3]]++;
+			}
+		}
+
+		ushort coarse[16] = { 0 };
+		ushort fine[256];
+		int fine_start[16];		// Window start column each coarse bin's fine bins are up to date for
+		for (int bin = 0; bin < 16; bin++) fine_start[bin] = -size - 1;
+		for (int col = 0; col < size; col++) {
+			for (int bin = 0; bin < 16; bin++) coarse[bin] += column_coarse[col * 16 + bin];
+		}
+
+		uchar* out = output.ptr<uchar>(row) + channel;
+		for (int col = 0; col < output.cols; col++) {
+			if (col > 0) {
+				const uchar* entering = &column_coarse[(col + 2 * radius) * 16];
+				const uchar* leaving = &column_coarse[(col - 1) * 16];
+				for (int bin = 0; bin < 16; bin++) coarse[bin] += entering[bin] - leaving[bin];
+			}
+
+			int count = 0;
+			int high = 0;
+			while (count + coarse[high] <= rank) count += coarse[high++];
+
+			ushort* segment = fine + high * 16;
+			if (col - fine_start[high] >= size) {
+				// Too far behind, cheaper to add up the window's columns again
+				for (int bin = 0; bin < 16; bin++) segment[bin] = 0;
+				for (int window = col; window < col + size; window++) {
+					const uchar* column = &column_fine[window * 256 + high * 16];
+					for (int bin = 0; bin < 16; bin++) segment[bin] += column[bin];
+				}
+			}
+			else {
+				for (int start = fine_start[high] + 1; start <= col; start++) {
+					const uchar* entering = &column_fine[(start + 2 * radius) * 256 + high * 16];
+					const uchar* leaving = &column_fine[(start - 1) * 256 + high * 16];
+					for (int bin = 0; bin < 16; bin++) segment[bin] += entering[bin] - leaving[bin];
+				}
+			}
+			fine_start[high] = col;
 
-			pic.at<Vec3b>(row, col)[0] = FixComputedColor(new_blue);
-			pic.at<Vec3b>(row, col)[1] = FixComputedColor(new_green);
-			pic.at<Vec3b>(row, col)[2] = FixComputedColor(new_red);
+			int low = 0;
+			while (count + segment[low] <= rank) count += segment[low++];
+			out[col * 3] = uchar(high * 16 + low);
 		}
 	}
 }
 
-// Modifies the saturation in each pixel in the given image, using saturation value in HSV
-// Preconditions: image is colored and of the correct type and correctly allocated
-// Postconditions: given image's saturation is changed by the global constant sat_val amount
-void ModifySaturation(Mat& image, int const saturate) {
-	Mat saturated;
-	cvtColor(image, saturated, COLOR_BGR2HSV);
-	for (int row = 0; row < saturated.rows; row++) {
-		for (int col = 0; col < saturated.cols; col++) {
-			double og = (double)saturated.at<Vec3b>(row, col)[1];
-			int newVal = FixComputedColor(og + saturate);
-			saturated.at<Vec3b>(row, col)[1] = newVal;
+// HistogramMedianBlur
+// Precondition: image is colored, size is odd and at least 3
+// Postcondition: output is medianBlur of image with size, the same at the borders, worked out in a
+//                number of steps per pixel that does not grow with size. Row bands run in parallel,
+//                each with its own column histograms. image and output may be the same Mat.
+void HistogramMedianBlur(const Mat& image, Mat& output, int const size) {
+	int const radius = size / 2;
+	thread_local Mat border;	// Kept for the next frame, the bands read the caller's through padded
+	Mat& padded = border;
+	copyMakeBorder(image, padded, radius, radius, radius, radius, BORDER_REPLICATE);
+	output.create(image.size(), image.type());
+	ParallelRows(image.rows, [&](int start_row, int end_row) {
+		for (int channel = 0; channel < 3; channel++) {
+			HistogramMedianRows(padded, output, channel, radius, start_row, end_row);
 		}
+	});
+}
+
+// BoxGaussianBlur
+// Precondition: image is colored and sigma is above 0
+// Postcondition: image is blurred by box_gaussian_passes box blurs, whose widths are picked so the
+//                passes together have the variance of a Gaussian of sigma. Each box blur takes the same
+//                time whatever its width.
+void BoxGaussianBlur(Mat& image, double const sigma) {
+	int const passes = box_gaussian_passes;
+	double const ideal = sqrt(12 * sigma * sigma / passes + 1);
+	int narrow = (int)floor(ideal);
+	if (narrow % 2 == 0) narrow--;
+	narrow = max(narrow, 1);
+	int const wide = narrow + 2;
+	int const narrow_passes = cvRound((12 * sigma * sigma - passes * narrow * narrow - 4 * passes * narrow - 3 * passes) /
+		(-4.0 * narrow - 4));
+	for (int pass = 0; pass < passes; pass++) {
+		int const width = pass < narrow_passes ? narrow : wide;
+		blur(image, image, Size(width, width));
 	}
-	cvtColor(saturated, image, COLOR_HSV2BGR);
+}
+
+// SmoothWithContrast
+// Precondition: Same as PrepareImage, image is at least 2 pixels in each direction
+// Postcondition: image gets the median blur, the contrast and the Gaussian blur of PrepareImage, with
+//                the blurs done by smoothing
+static void SmoothWithContrast(Mat& image, Scalar& contrast_mean, int const scale, bool const integer_math,
+	SmoothingBackend const smoothing) {
+	int const median_size = max(3, (median_blur / scale) | 1);
+	int const gaussian_size = max(3, (gaus_blur_size / scale) | 1);
+	double const gaussian_amount = double(gaus_blur_amount) / scale;
+
+	if (smoothing == DOWNSCALED_SMOOTHING) {
+		// Blurring a half size copy with kernels shrunk to match covers the same part of the scene
+		Mat small;
+		resize(image, small, Size(image.cols / 2, image.rows / 2), 0, 0, INTER_AREA);
+		SmoothWithContrast(small, contrast_mean, scale * 2, integer_math, OPENCV_SMOOTHING);
+		resize(small, image, image.size(), 0, 0, INTER_LINEAR);
+		return;
+	}
+
+	if (smoothing == HISTOGRAM_MEDIAN_SMOOTHING || smoothing == FAST_SMOOTHING) {
+		HistogramMedianBlur(image, image, median_size);
+	}
+	else medianBlur(image, image, median_size);
+	// Contrast has to stay before the blur, clipping it afterwards moves bright edges by up to 30
+	ModifyContrast(image, contrast_num, contrast_mean, integer_math);
+	if (smoothing == BOX_GAUSSIAN_SMOOTHING || smoothing == FAST_SMOOTHING) {
+		BoxGaussianBlur(image, gaussian_amount);
+	}
+	else GaussianBlur(image, image, Size(gaussian_size, gaussian_size), gaussian_amount);
+}
+
+// PrepareMargin
+// Precondition: scale is the scale PrepareImage is given
+// Postcondition: Returns how far past a pixel the blurs of PrepareImage read. A crop grown by this much
+//                on every side and prepared on its own matches the whole prepared frame inside the
+//                original crop.
+int PrepareMargin(int const scale) {
+	return max(3, (median_blur / scale) | 1) / 2 + max(3, (gaus_blur_size / scale) | 1) / 2;
 }
 
 // PrepareImage
@@ -110,11 +497,86 @@ void ModifySaturation(Mat& image, int const saturate) {
 // Postcondition: Will modify image by putting various blurrs and filters on top. image will
 //                be modified slightly differently depending if it is a background or not.
 void PrepareImage(Mat& image) {
-	medianBlur(image, image, median_blur);
-	ModifyContrast(image, contrast_num);
-	GaussianBlur(image, image, Size(gaus_blur_size, gaus_blur_size), gaus_blur_amount);
+	Scalar contrast_mean = Scalar::all(-1);
+	PrepareImage(image, contrast_mean);
+}
+
+// PrepareImage
+// Precondition: Parameters and image is properly formatted, passed in correctly and colored.
+//               contrast_mean is the value left by the previous frame, or negative for none.
+// Postcondition: Same as PrepareImage, with the contrast centred on contrast_mean so it is done in
+//                a single pass. contrast_mean is updated with this frame's mean for the next one.
+void PrepareImage(Mat& image, Scalar& contrast_mean) {
+	PrepareImage(image, contrast_mean, 1);
+}
+
+// PrepareImage
+// Precondition: Same as PrepareImage, image is a frame shrunk by scale in each direction
+// Postcondition: Same as PrepareImage, with the blurs shrunk by scale as well so they cover the same
+//                part of the scene as on the full frame
+void PrepareImage(Mat& image, Scalar& contrast_mean, int const scale) {
+	PrepareImage(image, contrast_mean, scale, integer_preprocessing, smoothing_backend);
+}
+
+// PrepareImage
+// Precondition: Same as PrepareImage
+// Postcondition: Same as PrepareImage, with the contrast, brightness and saturation done in integer
+//                and fixed point math when integer_math is set and in double otherwise, and the blurs
+//                done by smoothing. Images too small to halve are smoothed by OpenCV instead of
+//                DOWNSCALED_SMOOTHING.
+void PrepareImage(Mat& image, Scalar& contrast_mean, int const scale, bool const integer_math,
+	SmoothingBackend smoothing) {
+	if (smoothing == DOWNSCALED_SMOOTHING && min(image.rows, image.cols) < 4) smoothing = OPENCV_SMOOTHING;
+	SmoothWithContrast(image, contrast_mean, scale, integer_math, smoothing);
+	if (fused_color_adjust) {
+		ApplyBrightnessSaturation(image, brightness_level, sat_val, integer_math);
+		return;
+	}
 	image.convertTo(image, -1, 1, brightness_level);
-	ModifySaturation(image, sat_val);
+	ModifySaturation(image, sat_val, integer_math);
+}
+
+// BackgroundRemover
+// Precondition: Parameters are properly formatted, passed in correctly and colored
+// Postcondition: output will be a binary Mat where the white spots are the differences between the
+//                2 passed in Mats and the skin test passes. output is only reallocated when it does
+//                not already have the size of back.
+void BackgroundRemover(const Mat& front, const Mat& back, Mat& output) {
+	output.create(back.rows, back.cols, CV_8U);
+	ParallelRows(back.rows, [&](int start_row, int end_row) {
+		for (int row = start_row; row < end_row; row++) {
+			BackgroundDiffRow(front.ptr<uchar>(row), back.ptr<uchar>(row), output.ptr<uchar>(row),
+				back.cols, background_remover_thresh, red_color_thresh);
+		}
+	});
+}
+
+// BackgroundRemover
+// Precondition: Parameters are properly formatted, passed in correctly and colored
+// Postcondition: output holds the runs of the mask the BackgroundRemover above makes. Each band of
+//                rows is diffed a row at a time into a buffer its thread keeps and turned into runs
+//                right away, so the whole byte mask is never written.
+void BackgroundRemover(const Mat& front, const Mat& back, RunMask& output) {
+	ClearRunMask(output, back.size());
+	int const bands = RowBands(back.rows);
+	thread_local vector<vector<MaskRun>> band_runs;
+	vector<vector<MaskRun>>& runs = band_runs;
+	if ((int)runs.size() < bands) runs.resize(bands);
+	int* const row_runs = output.row_start.data() + 1;
+	ParallelRowBands(back.rows, bands, [&](int band, int start_row, int end_row) {
+		thread_local vector<uchar> diff_row;
+		diff_row.resize(back.cols);
+		runs[band].clear();
+		for (int row = start_row; row < end_row; row++) {
+			BackgroundDiffRow(front.ptr<uchar>(row), back.ptr<uchar>(row), diff_row.data(), back.cols,
+				background_remover_thresh, red_color_thresh);
+			row_runs[row] = AppendMaskRuns(runs[band], diff_row.data(), back.cols);
+		}
+	});
+	for (int row = 0; row < back.rows; row++) output.row_start[row + 1] += output.row_start[row];
+	for (int band = 0; band < bands; band++) {
+		output.runs.insert(output.runs.end(), runs[band].begin(), runs[band].end());
+	}
 }
 
 // BackgroundRemover
@@ -122,101 +584,342 @@ void PrepareImage(Mat& image) {
 // Postcondition: Will return a binary Matt where the white spots are the differences
 //                between the 2 passed in Mats.
 Mat BackgroundRemover(const Mat& front, const Mat& back) {
-	Mat output(back.rows, back.cols, CV_8U);
-	for (int row = 0; row < back.rows; row++) {
-		for (int col = 0; col < back.cols; col++) {
-			int front_color_b = front.at<Vec3b>(row, col)[0];
-			int front_color_g = front.at<Vec3b>(row, col)[1];
-			int front_color_r = front.at<Vec3b>(row, col)[2];
-			int back_color_b = back.at<Vec3b>(row, col)[0];
-			int back_color_g = back.at<Vec3b>(row, col)[1];
-			int back_color_r = back.at<Vec3b>(row, col)[2];
-			if (abs(front_color_b - back_color_b) < background_remover_thresh &&
-				abs(front_color_g - back_color_g) < background_remover_thresh &&
-				abs(front_color_r - back_color_r) < background_remover_thresh) {	//Very similar
-				output.at<uchar>(row, col) = 0;
-			}
-			else {	//Not similar. Object here
-				if ((front_color_r >= red_color_thresh) ||
-					(front_color_r < red_color_thresh &&
-						front_color_r > front_color_b &&
-						front_color_r > front_color_g)) {
-					output.at<uchar>(row, col) = 255;
-				}
-				else output.at<uchar>(row, col) = 0;;
-			}
+	Mat output;
+	BackgroundRemover(front, back, output);
+	return output;
+}
+
+// FullResolutionMask
+// Precondition: frame is a full resolution colored image, coarse_background is the prepared background
+//               shrunk by scale, region is part of frame
+// Postcondition: region is grown to whole blocks of scale pixels that coarse_background covers, and
+//                mask is the full resolution background removed mask of it. The region is prepared
+//                with contrast_mean, together with a PrepareMargin border of frame so its edges are
+//                blurred as in the whole frame, and the matching part of coarse_background is scaled
+//                up to it.
+void FullResolutionMask(const Mat& frame, const Mat& coarse_background, int const scale,
+	const Scalar& contrast_mean, Rect& region, Mat& mask) {
+	Rect coarse(region.x / scale, region.y / scale, 0, 0);
+	coarse.width = (region.br().x + scale - 1) / scale - coarse.x;
+	coarse.height = (region.br().y + scale - 1) / scale - coarse.y;
+	coarse &= Rect(0, 0, coarse_background.cols, coarse_background.rows);
+	region = Rect(coarse.x * scale, coarse.y * scale, coarse.width * scale, coarse.height * scale);
+	if (region.empty()) {
+		mask.release();
+		return;
+	}
+
+	int const margin = PrepareMargin(1);
+	Rect const padded = Rect(region.x - margin, region.y - margin, region.width + 2 * margin,
+		region.height + 2 * margin) & Rect(0, 0, frame.cols, frame.rows);
+	Mat image = frame(padded).clone();
+	Scalar region_mean = contrast_mean;
+	PrepareImage(image, region_mean);
+	Mat back;
+	resize(coarse_background(coarse), back, region.size(), 0, 0, INTER_LINEAR);
+	BackgroundRemover(image(Rect(region.tl() - padded.tl(), region.size())), back, mask);
+}
+
+// PickSampleFrames
+// Precondition: number_of_frames and samples are positive
+// Postcondition: Returns up to samples distinct random frame indices in increasing order, so the
+//                video can be read front to back while collecting them
+vector<int> PickSampleFrames(int const number_of_frames, int const samples) {
+	vector<bool> chosen(number_of_frames, false);
+	vector<int> random_frames;
+	int const wanted = std::min(samples, number_of_frames);
+	while ((int)random_frames.size() < wanted) {
+		int random_frame = rand() % number_of_frames;
+		if (!chosen[random_frame]) {
+			chosen[random_frame] = true;
+			random_frames.push_back(random_frame);
 		}
 	}
-	return output;
+	sort(random_frames.begin(), random_frames.end());
+	return random_frames;
+}
+
+// ReadFrameAt
+// Precondition: video is correctly formatted and allocated, position is the index of the next frame
+//               video will return
+// Postcondition: frame holds the frame at index target and position is moved past it. Nearby frames
+//                are reached by grabbing without decoding, far ones by seeking. Returns false when
+//                the video ends first.
+bool ReadFrameAt(VideoCapture& video, int& position, int const target, Mat& frame) {
+	if (target - position > sample_seek_distance) {
+		video.set(CAP_PROP_POS_FRAMES, target);
+		position = target;
+	}
+	for (; position < target; position++) {
+		if (!video.grab()) return false;
+	}
+	video >> frame;
+	position++;
+	return !frame.empty();
+}
+
+// HistogramMedian
+// Precondition: values points to count bytes spaced stride bytes apart
+// Postcondition: Returns the lower median of the values, found with a 16 bin histogram of the high
+//                4 bits and then a 16 bin histogram of the low 4 bits inside the bin holding it
+uchar HistogramMedian(const uchar* values, size_t const stride, int const count) {
+	int coarse[16] = { 0 };
+	for (int i = 0; i < count; i++) {
+		coarse[values[i * stride] >> 4]++;
+	}
+	int target = (count - 1) / 2;
+	int high = 0;
+	while (target >= coarse[high]) {
+		target -= coarse[high];
+		high++;
+	}
+
+	int fine[16] = { 0 };
+	for (int i = 0; i < count; i++) {
+		uchar value = values[i * stride];
+		if ((value >> 4) == high) {
+			fine[value & 15]++;
+		}
+	}
+	int low = 0;
+	while (target >= fine[low]) {
+		target -= fine[low];
+		low++;
+	}
+	return uchar((high << 4) | low);
+}
+
+// AverageReciprocal
+// Precondition: count is between 1 and 255
+// Postcondition: Returns the multiplier that divides a sum of count bytes by count, the product shifted
+//                down by average_reciprocal_shift is the truncated average. Rounding the reciprocal
+//                up keeps it exact as long as the sum times count stays under 2 to the shift.
+unsigned AverageReciprocal(int const count) {
+	return (1u << average_reciprocal_shift) / unsigned(count) + 1;
 }
 
 // Detects and extracts the background from given video
 // preconditions: video is correctly formatted and allocated
-// postconditions: the calculated background from the video is returned as a Mat
-Mat ExtractBackground(VideoCapture& video) {
+// postconditions: the calculated background from the video is returned as a Mat. The sampled frames
+//                 are read in order by seeking to them, and are combined by the given estimator:
+//                 MEAN_ESTIMATOR sums them in one CV_32SC3 buffer, MEDIAN_ESTIMATOR keeps them in
+//                 one contiguous stack and takes the median of every pixel.
+Mat ExtractBackground(VideoCapture& video, BackgroundEstimator const estimator) {
 	const int frame_width = (int)video.get(CAP_PROP_FRAME_WIDTH);
 	const int frame_height = (int)video.get(CAP_PROP_FRAME_HEIGHT);
 	const int number_of_frames = (int)video.get(CAP_PROP_FRAME_COUNT);
-	vector<int> random_frames;
+	vector<int> random_frames = PickSampleFrames(std::max(number_of_frames, 1), number_random_frames);
 
-	// Determine which random frames to use for background calculation
-	for (int i = 0; i < number_random_frames; i++) {
-		int random_frame = rand() % number_of_frames;
-		while (find(random_frames.begin(), random_frames.end(), random_frame) != random_frames.end()) {
-			random_frame = rand() % number_of_frames;
-		}
-		random_frames.push_back(random_frame);
+	Mat extracted_background(frame_height, frame_width, CV_8UC3, Scalar::all(0));
+	Mat sums;
+	Mat stack;
+	if (estimator == MEAN_ESTIMATOR) {
+		sums.create(frame_height, frame_width, CV_32SC3);
+		sums.setTo(Scalar::all(0));
+	}
+	else {
+		stack.create(frame_height * (int)random_frames.size(), frame_width, CV_8UC3);
 	}
 
-	Mat extracted_background(frame_height, frame_width, CV_8UC3, Scalar::all(0));
+	// Go to each random frame and add it to the estimator
 	Mat frame;
-	int curFrame = 0;
-	bool firstRandomFrame = true;
-	vector<vector<vector<int>>> backgroundPixels(frame_height);
-
-	// Go through each random frame and add its values to each pixel in extracted background
-	for (;;) {
-		video >> frame;
-		if (frame.empty()) {
+	int position = 0;
+	int collected = 0;
+	for (int i = 0; i < (int)random_frames.size(); i++) {
+		if (!ReadFrameAt(video, position, random_frames[i], frame)) {
 			break;
 		}
-		if (find(random_frames.begin(), random_frames.end(), curFrame) != random_frames.end()) {
-			for (int row = 0; row < frame_height; row++) {
-				if (firstRandomFrame) {
-					vector<vector<int>> temp(frame_width);
-					backgroundPixels.at(row) = temp;
-				}
-				for (int col = 0; col < frame_width; col++) {
-					if (firstRandomFrame) {
-						vector<int> colorValues(3);
-						backgroundPixels.at(row).at(col) = colorValues;
-						backgroundPixels.at(row).at(col).at(2) = frame.at<Vec3b>(row, col)[2];
-						backgroundPixels.at(row).at(col).at(1) = frame.at<Vec3b>(row, col)[1];
-						backgroundPixels.at(row).at(col).at(0) = frame.at<Vec3b>(row, col)[0];
-					}
-					else {
-						backgroundPixels.at(row).at(col).at(2) += frame.at<Vec3b>(row, col)[2];
-						backgroundPixels.at(row).at(col).at(1) += frame.at<Vec3b>(row, col)[1];
-						backgroundPixels.at(row).at(col).at(0) += frame.at<Vec3b>(row, col)[0];
+		ParallelRows(frame_height, [&](int start_row, int end_row) {
+			for (int row = start_row; row < end_row; row++) {
+				const uchar* pixel = frame.ptr<uchar>(row);
+				if (estimator == MEAN_ESTIMATOR) {
+					int* sum = sums.ptr<int>(row);
+					for (int col = 0; col < frame_width * 3; col++) {
+						sum[col] += pixel[col];
 					}
 				}
+				else {
+					memcpy(stack.ptr<uchar>(collected * frame_height + row), pixel, frame_width * 3);
+				}
+			}
+		});
+		collected++;
+	}
+	if (collected == 0) {
+		video.set(CAP_PROP_POS_FRAMES, 0);
+		return extracted_background;
+	}
+
+	// Combine the collected frames into the final background from video
+	size_t const frame_stride = stack.empty() ? 0 : stack.step[0] * frame_height;
+	unsigned const reciprocal = AverageReciprocal(collected);
+	ParallelRows(frame_height, [&](int start_row, int end_row) {
+		for (int row = start_row; row < end_row; row++) {
+			uchar* background = extracted_background.ptr<uchar>(row);
+			if (estimator == MEAN_ESTIMATOR && integer_preprocessing) {
+				const int* sum = sums.ptr<int>(row);
+				for (int col = 0; col < frame_width * 3; col++) {
+					background[col] = uchar((unsigned(sum[col]) * reciprocal) >> average_reciprocal_shift);
+				}
+			}
+			else if (estimator == MEAN_ESTIMATOR) {
+				const int* sum = sums.ptr<int>(row);
+				for (int col = 0; col < frame_width * 3; col++) {
+					background[col] = FixComputedColor(sum[col] / collected);
+				}
+			}
+			else {
+				const uchar* samples = stack.ptr<uchar>(row);
+				for (int col = 0; col < frame_width * 3; col++) {
+					background[col] = HistogramMedian(samples + col, frame_stride, collected);
+				}
 			}
-			firstRandomFrame = false;
 		}
-		curFrame++;
+	});
+	video.set(CAP_PROP_POS_FRAMES, 0);
+	return extracted_background;
+}
+
+// Detects and extracts the background from given video
+// preconditions: video is correctly formatted and allocated
+// postconditions: the calculated background from the video is returned as a Mat
+Mat ExtractBackground(VideoCapture& video) {
+	return ExtractBackground(video, MEAN_ESTIMATOR);
+}
+
+// UpdateBackgroundModel
+// Precondition: frame is a prepared colored image. foreground is empty or a binary mask the size of
+//               frame marking where the hand is.
+// Postcondition: model's running average takes in frame. For the first background_warmup_frames
+//                frames every pixel is a plain average. After that pixels under foreground are left
+//                alone so the hand is not absorbed, and the rest move toward frame by
+//                background_learning_rate, or keep a plain average when it is 0.
+void UpdateBackgroundModel(BackgroundModel& model, const Mat& frame, const Mat& foreground) {
+	if (model.frames_seen == 0) {
+		frame.convertTo(model.average, CV_32FC3);
+		frame.copyTo(model.background);
+		model.frames_seen = 1;
+		return;
 	}
 
-	// Average every pixel in background to get final background from video
-	for (int row = 0; row < frame_height; row++) {
-		for (int col = 0; col < frame_width; col++) {
-			extracted_background.at<Vec3b>(row, col)[2] =
-				FixComputedColor(backgroundPixels.at(row).at(col).at(2) / number_random_frames);
-			extracted_background.at<Vec3b>(row, col)[1] =
-				FixComputedColor(backgroundPixels.at(row).at(col).at(1) / number_random_frames);
-			extracted_background.at<Vec3b>(row, col)[0] =
-				FixComputedColor(backgroundPixels.at(row).at(col).at(0) / number_random_frames);
+	bool const warming_up = model.frames_seen < background_warmup_frames;
+	float const rate = (warming_up || background_learning_rate <= 0) ?
+		1.0f / (model.frames_seen + 1) : float(background_learning_rate);
+	bool const use_mask = !warming_up && !foreground.empty();
+
+	ParallelRows(frame.rows, [&](int start_row, int end_row) {
+		for (int row = start_row; row < end_row; row++) {
+			const uchar* pixel = frame.ptr<uchar>(row);
+			const uchar* mask = use_mask ? foreground.ptr<uchar>(row) : nullptr;
+			float* average = model.average.ptr<float>(row);
+			uchar* background = model.background.ptr<uchar>(row);
+			for (int col = 0; col < frame.cols; col++, pixel += 3, average += 3, background += 3) {
+				if (mask != nullptr && mask[col] != 0) {	// Hand here
+					continue;
+				}
+				for (int channel = 0; channel < 3; channel++) {
+					average[channel] += rate * (pixel[channel] - average[channel]);
+					background[channel] = uchar(average[channel] + 0.5f);
+				}
+			}
+		}
+	});
+	model.frames_seen++;
+}
+
+// UpdateBackgroundModel
+// Precondition: Same as UpdateBackgroundModel, with frame and foreground covering only region of the
+//               model, which has already taken in at least one whole frame
+// Postcondition: Same as UpdateBackgroundModel inside region, the rest of the model is left alone
+void UpdateBackgroundModel(BackgroundModel& model, const Mat& frame, const Mat& foreground,
+	const Rect& region) {
+	if (model.frames_seen == 0) return;
+	BackgroundModel view;
+	view.average = model.average(region);
+	view.background = model.background(region);
+	view.frames_seen = model.frames_seen;
+	UpdateBackgroundModel(view, frame, foreground);
+	model.frames_seen = view.frames_seen;
+}
+
+// BackgroundModelReady
+// Precondition: model is correctly allocated
+// Postcondition: Returns true once model has seen enough frames to be used for background removal
+bool BackgroundModelReady(const BackgroundModel& model) {
+	return model.frames_seen >= background_warmup_frames;
+}
+
+// ValidateIntegerPreprocessing
+// Precondition: frame is a colored frame from the video
+// Postcondition: Runs contrast, saturation and the whole of PrepareImage on copies of frame once in
+//                integer math and once in double, and returns the largest difference in any channel
+//                of any pixel for each of them. The last entry is the largest difference between the
+//                reciprocal and the plain background average over every sum of up to
+//                number_random_frames frames.
+Vec4i ValidateIntegerPreprocessing(const Mat& frame) {
+	Vec4i deviation;
+	Mat integer_image;
+	Mat double_image;
+	Scalar integer_mean;
+	Scalar double_mean;
+
+	integer_image = frame.clone();
+	double_image = frame.clone();
+	integer_mean = double_mean = Scalar::all(-1);
+	ModifyContrast(integer_image, contrast_num, integer_mean, true);
+	ModifyContrast(double_image, contrast_num, double_mean, false);
+	deviation[0] = (int)norm(integer_image, double_image, NORM_INF);
+
+	integer_image = frame.clone();
+	double_image = frame.clone();
+	ModifySaturation(integer_image, sat_val, true);
+	ModifySaturation(double_image, sat_val, false);
+	deviation[1] = (int)norm(integer_image, double_image, NORM_INF);
+
+	integer_image = frame.clone();
+	double_image = frame.clone();
+	integer_mean = double_mean = Scalar::all(-1);
+	PrepareImage(integer_image, integer_mean, 1, true, smoothing_backend);
+	PrepareImage(double_image, double_mean, 1, false, smoothing_backend);
+	deviation[2] = (int)norm(integer_image, double_image, NORM_INF);
+
+	deviation[3] = 0;
+	for (int count = 1; count <= number_random_frames; count++) {
+		unsigned const reciprocal = AverageReciprocal(count);
+		for (int sum = 0; sum <= 255 * count; sum++) {
+			int const reciprocal_average = int((unsigned(sum) * reciprocal) >> average_reciprocal_shift);
+			deviation[3] = max(deviation[3], abs(reciprocal_average - FixComputedColor(sum / count)));
 		}
 	}
-	video.set(CAP_PROP_POS_MSEC, 0);
-	return extracted_background;
+	return deviation;
+}
+
+// SmoothingAgreement
+// Precondition: frame and background are colored images of the same size, as read from the video
+// Postcondition: Prepares both with OPENCV_SMOOTHING and with smoothing and removes the background
+//                from each. Returns the share of mask pixels the two masks agree on, then the
+//                intersection over union of their foregrounds (1 when neither has any).
+Vec2d SmoothingAgreement(const Mat& frame, const Mat& background, SmoothingBackend const smoothing) {
+	Mat masks[2];
+	SmoothingBackend const backends[2] = { OPENCV_SMOOTHING, smoothing };
+	for (int i = 0; i < 2; i++) {
+		Mat front = frame.clone();
+		Mat back = background.clone();
+		Scalar front_mean = Scalar::all(-1);
+		Scalar back_mean = Scalar::all(-1);
+		PrepareImage(front, front_mean, 1, integer_preprocessing, backends[i]);
+		PrepareImage(back, back_mean, 1, integer_preprocessing, backends[i]);
+		BackgroundRemover(front, back, masks[i]);
+	}
+
+	Mat differ;
+	Mat both;
+	Mat either;
+	compare(masks[0], masks[1], differ, CMP_NE);
+	bitwise_and(masks[0], masks[1], both);
+	bitwise_or(masks[0], masks[1], either);
+	int const union_pixels = countNonZero(either);
+	double const agreement = 1.0 - countNonZero(differ) / double(differ.total());
+	double const overlap = union_pixels > 0 ? countNonZero(both) / double(union_pixels) : 1.0;
+	return Vec2d(agreement, overlap);
 }
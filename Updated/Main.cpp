@@ -10,11 +10,22 @@
 #include <cmath>
 #include <opencv2/core/types.hpp>
 #include <vector>
+#include <atomic>
+#include <fstream>
+#include <stdio.h>
 #include <stdlib.h>
 #include <opencv2/imgcodecs.hpp>
 #include <opencv2/videoio.hpp>
 #include <opencv2/video.hpp>
 #include "Hand.h"
+#include "BackgroundModel.h"
+#include "Pipeline.h"
+#include "Parallel.h"
+#include "FrameScheduler.h"
+#include "HandTracker.h"
+#include "StageTimer.h"
+#include "FramePool.h"
+#include "AllocationCounter.h"
 using namespace cv;
 using namespace std;
 
@@ -26,92 +37,454 @@ using namespace std;
 
 string const video_name_path = "hand.mp4";
 int const skip_frames = 3;
-Scalar const box_color = Scalar{ 0, 0, 255 };
+bool const adaptive_schedule = false;	// Analyze by motion and time left instead of every skip_frames, see StageBenchmark
+bool const online_background = true;
+bool const component_candidates = true;	// Label the mask's components and trace only the big ones
+bool const run_length_mask = false;	// The background remover writes runs, and candidates are labelled from them
+bool const record_masks = false;	// Append each analyzed region's mask as runs to the output name plus .rle
+bool const tracked_region = false;	// Analyze only around the last hand, searching the whole frame now and then
+int const pyramid_scale = 1;	// 2 or 4 searches a frame shrunk that much and refines the hand at full size
+bool const pyramid_refine_type = true;	// Count the fingers again at full size
+BackgroundEstimator const background_estimator = MEDIAN_ESTIMATOR;
+bool const threaded_pipeline = false;
+int const pipeline_threads = 0;	// 0 uses one worker per core
+int const worker_threads = 0;	// Threads for the per pixel loops, 0 uses one per core
+int const batch_threads = 0;	// Videos processed at once in batch mode, 0 uses one per core
+bool const validate_integer_path = false;	// Compare the integer preprocessing with the double one on each analyzed frame
+#ifdef HAND_STAGE_TIMING
+string const stage_trace_path = "stage_trace.json";	// Open in chrome://tracing or ui.perfetto.dev
+string const stage_summary_path = "stage_summary.csv";
+#endif
 
-Mat ExtractBackground(VideoCapture& video);
+// What processing one video did, for the batch summary
+struct VideoStats {
+	string input;
+	bool opened = false;
+	int frames = 0;
+	int analyzed = 0;
+	int hands = -1;			// Analyzed frames a hand was found in, -1 when not counted
+	double seconds = 0;
+};
+
+Mat ExtractBackground(VideoCapture& video, BackgroundEstimator const estimator);
 void PrepareImage(Mat& image);
-Mat BackgroundRemover(const Mat& front, const Mat& back);
-vector<vector<Point>> FindImageContours(const Mat& object);
-bool CompareContourAreas(const vector<Point> contour1, const vector<Point> contour2);
-Hand SearchForHand(const Mat& front, const vector<vector<Point>>& contours, Rect& box);
-void PrintHandType(Mat& frame, const int h_type);
-void PrintHandLocation(Mat& frame, const Point hand_pos);
+void PrepareImage(Mat& image, Scalar& contrast_mean);
+void PrepareImage(Mat& image, Scalar& contrast_mean, int const scale);
+int PrepareMargin(int const scale);
+void FullResolutionMask(const Mat& frame, const Mat& coarse_background, int const scale,
+	const Scalar& contrast_mean, Rect& region, Mat& mask);
+void BackgroundRemover(const Mat& front, const Mat& back, Mat& output);
+void BackgroundRemover(const Mat& front, const Mat& back, RunMask& output);
+void FindImageContours(const Mat& object, vector<vector<Point>>& contours, DetectorScratch& scratch);
+void SelectHandCandidates(const vector<vector<Point>>& contours, const int area,
+	vector<ContourCandidate>& candidates);
+void ExtractHandCandidates(const Mat& mask, const int area, vector<vector<Point>>& contours,
+	vector<ContourCandidate>& candidates, DetectorScratch& scratch);
+void ExtractHandCandidates(const RunMask& mask, const int area, vector<vector<Point>>& contours,
+	vector<ContourCandidate>& candidates, DetectorScratch& scratch);
+Hand SearchForHand(const vector<vector<Point>>& contours, const vector<ContourCandidate>& candidates,
+	Rect& box, DetectorScratch& scratch);
+bool RefineHand(const Mat& object, Hand& hand, Rect& box, const bool refine_type);
 int HandMovementDirection(const Hand& current, const Hand& previous);
-Mat MovementDirectionShape(const int direction);
+void DrawHandInfo(Mat& frame, const Hand& hand, const int shape_type, const Rect& box);
+bool LoadHudAssets();
+bool ShouldAnalyze(FrameScheduler& scheduler, const Mat& frame);
+void RecordAnalysis(FrameScheduler& scheduler, const double milliseconds);
+void PrintSchedulerReport(const FrameScheduler& scheduler);
+void UpdateBackgroundModel(BackgroundModel& model, const Mat& frame, const Mat& foreground);
+void UpdateBackgroundModel(BackgroundModel& model, const Mat& frame, const Mat& foreground,
+	const Rect& region);
+bool BackgroundModelReady(const BackgroundModel& model);
+Vec4i ValidateIntegerPreprocessing(const Mat& frame);
+void AllocateFramePool(FramePool& pool, const Size& frame_size, int const scale);
+Rect PredictHandRegion(const HandTracker& tracker, const Size& frame_size);
+void UpdateHandTracker(HandTracker& tracker, const Hand& hand, const Rect& box, const Rect& region,
+	const Size& frame_size);
+int RunPipeline(VideoCapture& video, const Mat& background, VideoWriter& output, int const skip,
+	int const threads, const bool components);
 
 
-// Main Method - Video
-// Precondition: hand.mp4 exists in the code directory and is a valid mp4 video file.
-// Postcondition: Video output.avi gets outputted that identifies a hand with a box surrounding
-//                the hand, hand type and location is displayed on screen. And the movement direction
-//                of the hand is also displayed
-int main() {
-	VideoCapture cap(video_name_path);
-	if (!cap.isOpened()) return -1;
+// ProcessVideo
+// Precondition: input is a valid video file and the HUD icons are loaded. Other videos may be processed
+//               on other threads at the same time.
+// Postcondition: Video output gets outputted that identifies a hand with a box surrounding the hand,
+//                hand type and location is displayed on screen, and the movement direction of the hand
+//                is also displayed. stats says what was done, the scheduler report is printed when
+//                report is set. Returns false if input can not be opened.
+bool ProcessVideo(const string& input, const string& output, VideoStats& stats, const bool report) {
+	int64 const start = getTickCount();
+	stats.input = input;
+	VideoCapture cap(input);
+	if (!cap.isOpened()) return false;
+	stats.opened = true;
 
 	int const frame_width = (int)cap.get(CAP_PROP_FRAME_WIDTH);
 	int const frame_height = (int)cap.get(CAP_PROP_FRAME_HEIGHT);
 
-	Mat background = ExtractBackground(cap);
-	PrepareImage(background);
+	// The online model is built from the stream itself, the extracted one needs the whole video first.
+	// The threaded pipeline analyzes frames out of order, so it always uses the extracted one.
+	BackgroundModel background_model;
+	Mat background;
+	if (!online_background || threaded_pipeline) {
+		background = ExtractBackground(cap, background_estimator);
+		int const background_scale = threaded_pipeline ? 1 : pyramid_scale;	// The pipeline runs at full size
+		if (background_scale > 1) {
+			resize(background, background, Size(frame_width / background_scale, frame_height / background_scale), 0,
+				0, INTER_AREA);
+		}
+		Scalar background_mean = Scalar::all(-1);
+		PrepareImage(background, background_mean, background_scale);
+	}
 
 	Mat frame;
 	Hand current_hand;
 	Hand previous_hand;
-	Mat original_frame(frame_height, frame_width, CV_8UC3);
-	Mat front(frame_height, frame_width, CV_8UC3);
+	FramePool pool;
+	Mat& original_frame = pool.original;
+	HandTracker tracker;
 
-	VideoWriter output_vid("output.avi", VideoWriter::fourcc('M', 'J', 'P', 'G'),
+	VideoWriter output_vid(output, VideoWriter::fourcc('M', 'J', 'P', 'G'),
 		30, Size(frame_width, frame_height));
 
+	if (threaded_pipeline) {
+		int threads = pipeline_threads;
+		if (threads <= 0) {
+			threads = max(1, (int)thread::hardware_concurrency());
+		}
+		stats.frames = RunPipeline(cap, background, output_vid, skip_frames, threads, component_candidates);
+		stats.analyzed = stats.frames / skip_frames;
+		stats.seconds = (getTickCount() - start) / getTickFrequency();
+		output_vid.release();
+		cap.release();
+		return true;
+	}
+
+	AllocateFramePool(pool, Size(frame_width, frame_height), pyramid_scale);
+	FILE* mask_record = record_masks ? fopen((output + ".rle").c_str(), "wb") : nullptr;
 	int frame_num = 1;
 	int previous_shape_type = -1;
 	Rect prev_box;
+	Scalar contrast_mean = Scalar::all(-1);	// Previous analyzed frame's mean, lets contrast take one pass
+	FrameScheduler scheduler;
+	Vec4i integer_deviation(0, 0, 0, 0);
+	stats.hands = 0;
+	double const fps = cap.get(CAP_PROP_FPS);
+	if (fps > 0) scheduler.frame_budget_ms = 1000.0 / fps;
+#ifdef HAND_COUNT_ALLOCATIONS
+	FrameAllocations allocations;
+	bool stages_reset = false;
+	// The codecs allocate inside OpenCV on every frame, so they are taken out of each frame's count
+	auto codec_allocations = []() { return StageAllocationTotal("decode") + StageAllocationTotal("encode"); };
+#endif
 
 	while (true) {
-		cap >> frame;				// Reads in image frame
+#ifdef HAND_COUNT_ALLOCATIONS
+		bool const steady_state = stats.analyzed >= steady_state_analyses;
+		if (steady_state && !stages_reset) {
+			ResetStageAllocations();	// The per stage counts start after warm-up as well
+			stages_reset = true;
+		}
+		int64 const frame_allocations = HeapAllocations() - codec_allocations();
+#endif
+		STAGE_FRAME(stats.frames);
+		{
+			STAGE_TIMER("decode");
+			cap >> frame;			// Reads in image frame
+		}
 		if (!frame.data) break;	// if there's no more frames then break
-		if (frame_num % skip_frames == 0) {	//decreases the number of frames being analyzed
-			original_frame = frame.clone();
+		stats.frames++;
+		bool analyze;	//decreases the number of frames being analyzed
+		if (adaptive_schedule) analyze = ShouldAnalyze(scheduler, frame);
+		else analyze = (frame_num % skip_frames == 0);
+		if (online_background && !BackgroundModelReady(background_model)) {
+			// Every frame goes into the model until it is ready, none are analyzed
+			Mat& prepared = pool.warmup;
+			{
+				STAGE_TIMER("prepare");
+				if (pyramid_scale > 1) {
+					resize(frame, prepared, Size(frame.cols / pyramid_scale, frame.rows / pyramid_scale), 0, 0,
+						INTER_AREA);
+				}
+				else frame.copyTo(prepared);
+				PrepareImage(prepared, contrast_mean, pyramid_scale);
+			}
+			STAGE_TIMER("model");
+			UpdateBackgroundModel(background_model, prepared, Mat());
+			analyze = false;
+		}
+		if (analyze) {
+			if (validate_integer_path) {
+				Vec4i const deviation = ValidateIntegerPreprocessing(frame);
+				for (int i = 0; i < 4; i++) integer_deviation[i] = max(integer_deviation[i], deviation[i]);
+			}
+			int64 const analyze_start = getTickCount();
+			frame.copyTo(original_frame);
+
+			// With the pyramid the search runs on a shrunk copy, the model and background are that size too
+			Mat work = frame;
+			if (pyramid_scale > 1) {
+				resize(frame, pool.coarse, Size(frame.cols / pyramid_scale, frame.rows / pyramid_scale), 0, 0,
+					INTER_AREA);
+				work = pool.coarse;
+			}
 
-			PrepareImage(frame);
-			front = BackgroundRemover(frame, background);
+			// Only the region around the last hand is worked on while it is tracked. It is prepared with a
+			// margin so the blurs near its edges read the frame, not a made up border, then cut back.
+			Rect region(0, 0, work.cols, work.rows);
+			if (tracked_region) region = PredictHandRegion(tracker, work.size());
+			bool const full_frame = (region.width == work.cols && region.height == work.rows);
+			int const margin = PrepareMargin(pyramid_scale);
+			Rect const padded = full_frame ? region : Rect(region.x - margin, region.y - margin,
+				region.width + 2 * margin, region.height + 2 * margin) & Rect(0, 0, work.cols, work.rows);
+			Mat prepared = full_frame ? work : PoolView(pool.region, padded.size());
+			if (!full_frame) work(padded).copyTo(prepared);
+			Mat image = prepared(Rect(region.tl() - padded.tl(), region.size()));
+			Mat mask = PoolView(pool.mask, region.size());
+			Scalar region_mean = contrast_mean;	// A region's mean is not the frame's, keep the frame's
 
-			vector<vector<Point>> contours = FindImageContours(front);
-			sort(contours.begin(), contours.end(), CompareContourAreas);
+			{
+				STAGE_TIMER("prepare");
+				PrepareImage(prepared, full_frame ? contrast_mean : region_mean, pyramid_scale);
+			}
+			{
+				STAGE_TIMER("diff");
+				Mat const back = online_background ? background_model.background(region) : background(region);
+				if (run_length_mask) {
+					BackgroundRemover(image, back, pool.runs);
+					if (online_background) DrawRunMask(pool.runs, mask);	// The model update still reads bytes
+				}
+				else BackgroundRemover(image, back, mask);
+			}
+			if (online_background) {
+				STAGE_TIMER("model");
+				UpdateBackgroundModel(background_model, image, mask, region);
+			}
+			if (mask_record != nullptr) {
+				if (!run_length_mask) EncodeRunMask(mask, pool.runs);
+				WriteRunMask(mask_record, pool.runs);
+			}
+
+			if (run_length_mask) {
+				STAGE_TIMER("contours");
+				ExtractHandCandidates(pool.runs, work.rows * work.cols, pool.contours, pool.candidates,
+					pool.detector);
+			}
+			else if (component_candidates) {
+				STAGE_TIMER("contours");
+				ExtractHandCandidates(mask, work.rows * work.cols, pool.contours, pool.candidates, pool.detector);
+			}
+			else {
+				{
+					STAGE_TIMER("contours");
+					FindImageContours(mask, pool.contours, pool.detector);
+				}
+				STAGE_TIMER("sort");
+				SelectHandCandidates(pool.contours, work.rows * work.cols, pool.candidates);
+			}
 			Rect box;
-			current_hand = SearchForHand(front, contours, box);
+			{
+				STAGE_TIMER("search");
+				current_hand = SearchForHand(pool.contours, pool.candidates, box, pool.detector);
+			}
+			if (current_hand.type != -1) {
+				box += region.tl();
+				current_hand.location += region.tl();
+			}
+			UpdateHandTracker(tracker, current_hand, box, region, work.size());
+
+			if (pyramid_scale > 1 && current_hand.type != -1) {
+				STAGE_TIMER("refine");
+				// Back to full size, then the box is found again at full size just around it
+				box = Rect(box.x * pyramid_scale, box.y * pyramid_scale, box.width * pyramid_scale,
+					box.height * pyramid_scale);
+				Rect refine(box.x - 2 * pyramid_scale, box.y - 2 * pyramid_scale, box.width + 4 * pyramid_scale,
+					box.height + 4 * pyramid_scale);
+				FullResolutionMask(original_frame, online_background ? background_model.background : background,
+					pyramid_scale, contrast_mean, refine, pool.refine_mask);
+				Rect refined;
+				if (RefineHand(pool.refine_mask, current_hand, refined, pyramid_refine_type)) {
+					box = refined + refine.tl();
+				}
+				current_hand.location = box.tl();
+			}
 
 			//Print info to screen
-			PrintHandType(original_frame, current_hand.type);
-			PrintHandLocation(original_frame, current_hand.location);
-			int shape_type = HandMovementDirection(current_hand, previous_hand);
-			Mat shape = MovementDirectionShape(shape_type);
-			shape.copyTo(original_frame(Rect(0, 0, shape.cols, shape.rows)));
+			int shape_type;
+			{
+				STAGE_TIMER("classify");
+				shape_type = HandMovementDirection(current_hand, previous_hand);
+			}
+			{
+				STAGE_TIMER("overlay");
+				DrawHandInfo(original_frame, current_hand, shape_type, box);
+			}
 			if (current_hand.type != -1) {
-				rectangle(original_frame, box, box_color, 2);
 				prev_box = box;
 			}
 			previous_shape_type = shape_type;
 			previous_hand.location = current_hand.location;
 			previous_hand.type = current_hand.type;
+			RecordAnalysis(scheduler, (getTickCount() - analyze_start) * 1000.0 / getTickFrequency());
+			stats.analyzed++;
+			if (current_hand.type != -1) stats.hands++;
 
+			STAGE_TIMER("encode");
 			output_vid.write(original_frame);
 			frame_num++;
 		}
 		else {
-			PrintHandType(frame, previous_hand.type);
-			PrintHandLocation(frame, previous_hand.location);
-			Mat shape = MovementDirectionShape(previous_shape_type);
-			shape.copyTo(frame(Rect(0, 0, shape.cols, shape.rows)));
-			if (previous_hand.type != -1) {
-				rectangle(frame, prev_box, box_color, 2);
+			{
+				STAGE_TIMER("overlay");
+				DrawHandInfo(frame, previous_hand, previous_shape_type, prev_box);
 			}
+			STAGE_TIMER("encode");
 			output_vid.write(frame);
 			frame_num++;
 		}
+#ifdef HAND_COUNT_ALLOCATIONS
+		if (steady_state) {
+			int64 const counted = HeapAllocations() - codec_allocations() - frame_allocations;
+			RecordFrameAllocations(allocations, analyze, counted);
+		}
+#endif
+	}
+	if (report && adaptive_schedule) PrintSchedulerReport(scheduler);
+	if (report && validate_integer_path) {
+		printf("Integer preprocessing, largest difference from double: contrast %d, saturation %d, "
+			"PrepareImage %d, background average %d\n", integer_deviation[0], integer_deviation[1],
+			integer_deviation[2], integer_deviation[3]);
 	}
+#ifdef HAND_COUNT_ALLOCATIONS
+	if (report) {
+		PrintFrameAllocations(allocations);
+		PrintStageAllocations();
+	}
+#endif
+	stats.seconds = (getTickCount() - start) / getTickFrequency();
+	if (mask_record != nullptr) fclose(mask_record);
 	output_vid.release();
 	cap.release();
+	return true;
+}
+
+// OutputNameFor
+// Precondition: input is the path of a video
+// Postcondition: Returns the path of its output, next to it with _output.avi in place of its extension
+string OutputNameFor(const string& input) {
+	size_t const slash = input.find_last_of("/\\");
+	size_t const dot = input.find_last_of('.');
+	string stem = (dot != string::npos && (slash == string::npos || dot > slash)) ? input.substr(0, dot) : input;
+	return stem + "_output.avi";
+}
+
+// ExpandInputs
+// Precondition: arguments are the command line arguments after the program name
+// Postcondition: Returns the videos they name in order. An argument with * or ? is a pattern that is
+//                replaced by the files matching it, and one starting with @ is a file listing one video
+//                per line.
+vector<string> ExpandInputs(const vector<string>& arguments) {
+	vector<string> inputs;
+	for (size_t i = 0; i < arguments.size(); i++) {
+		const string& argument = arguments[i];
+		if (!argument.empty() && argument[0] == '@') {
+			ifstream list(argument.substr(1));
+			string line;
+			while (getline(list, line)) {
+				if (!line.empty() && line.back() == '\r') line.pop_back();
+				if (!line.empty()) inputs.push_back(line);
+			}
+		}
+		else if (argument.find_first_of("*?") != string::npos) {
+			vector<string> matches;
+			glob(argument, matches, false);
+			inputs.insert(inputs.end(), matches.begin(), matches.end());
+		}
+		else inputs.push_back(argument);
+	}
+	return inputs;
+}
+
+// PrintBatchSummary
+// Precondition: all_stats holds one entry per processed video
+// Postcondition: Prints the frames, analyzed frames, frames with a hand, frames per second and wall
+//                time of each video, then the totals
+void PrintBatchSummary(const vector<VideoStats>& all_stats, const double wall_seconds) {
+	int total_frames = 0;
+	printf("%-40s %8s %9s %7s %9s %9s\n", "video", "frames", "analyzed", "hands", "fps", "seconds");
+	for (size_t i = 0; i < all_stats.size(); i++) {
+		const VideoStats& stats = all_stats[i];
+		if (!stats.opened) {
+			printf("%-40s could not be opened\n", stats.input.c_str());
+			continue;
+		}
+		string hands = stats.hands < 0 ? "-" : to_string(stats.hands);
+		double fps = stats.seconds > 0 ? stats.frames / stats.seconds : 0;
+		printf("%-40s %8d %9d %7s %9.1f %9.2f\n", stats.input.c_str(), stats.frames, stats.analyzed,
+			hands.c_str(), fps, stats.seconds);
+		total_frames += stats.frames;
+	}
+	printf("%d videos, %d frames in %.2f s, %.1f frames per second\n", (int)all_stats.size(), total_frames,
+		wall_seconds, wall_seconds > 0 ? total_frames / wall_seconds : 0);
+}
+
+// RunBatch
+// Precondition: inputs are the videos to process and the HUD icons are loaded
+// Postcondition: Every video is processed into its own output by a pool of batch_threads threads, each
+//                taking the next video when it finishes one, and the summary is printed. The per pixel
+//                loops run on one thread each, the videos themselves keep the cores busy. Returns -1
+//                if a video could not be opened.
+int RunBatch(const vector<string>& inputs) {
+	int threads = batch_threads > 0 ? batch_threads : max(1, (int)thread::hardware_concurrency());
+	threads = min(threads, (int)inputs.size());
+	SetWorkerThreads(1);
+
+	int64 const start = getTickCount();
+	vector<VideoStats> all_stats(inputs.size());
+	atomic<int> next(0);
+	vector<thread> pool;
+	for (int t = 0; t < threads; t++) {
+		pool.emplace_back([&]() {
+			for (int i = next++; i < (int)inputs.size(); i = next++) {
+				ProcessVideo(inputs[i], OutputNameFor(inputs[i]), all_stats[i], false);
+			}
+		});
+	}
+	for (size_t t = 0; t < pool.size(); t++) pool[t].join();
+
+	PrintBatchSummary(all_stats, (getTickCount() - start) / getTickFrequency());
+	for (size_t i = 0; i < all_stats.size(); i++) {
+		if (!all_stats[i].opened) return -1;
+	}
+	return 0;
+}
+
+// Main Method - Video
+// Precondition: With no arguments hand.mp4 exists in the code directory and is a valid mp4 video file.
+//               Otherwise the arguments are videos, patterns or @lists of videos to process in a batch.
+// Postcondition: Video output.avi gets outputted that identifies a hand with a box surrounding
+//                the hand, hand type and location is displayed on screen. And the movement direction
+//                of the hand is also displayed. In a batch each video gets its own name_output.avi.
+//                Built with HAND_STAGE_TIMING, the time of each stage of each frame is also written to
+//                stage_trace.json and summed up per stage in stage_summary.csv.
+int main(int argc, char** argv) {
+	if (!LoadHudAssets()) return -1;	// The icons are read once here, not per frame
+	if (argc > 1) {
+		vector<string> inputs = ExpandInputs(vector<string>(argv + 1, argv + argc));
+		if (inputs.empty()) return -1;
+		int const result = RunBatch(inputs);
+#ifdef HAND_STAGE_TIMING
+		WriteChromeTrace(stage_trace_path);
+		WriteStageSummary(stage_summary_path);
+#endif
+		return result;
+	}
+
+	SetWorkerThreads(worker_threads);
+	VideoStats stats;
+	if (!ProcessVideo(video_name_path, "output.avi", stats, true)) return -1;
+#ifdef HAND_STAGE_TIMING
+	WriteChromeTrace(stage_trace_path);
+	WriteStageSummary(stage_summary_path);
+#endif
 	return 0;
 }
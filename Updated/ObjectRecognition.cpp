@@ -8,6 +8,7 @@
 #include <opencv2/features2d.hpp>
 #include <iostream>
 #include <cmath>
+#include <climits>
 #include <opencv2/core/types.hpp>
 #include <vector>
 #include <stdlib.h>
@@ -15,6 +16,10 @@
 #include <opencv2/videoio.hpp>
 #include <opencv2/video.hpp>
 #include "Hand.h"
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HAND_SSE2 1
+#include <emmintrin.h>
+#endif
 using namespace cv;
 using namespace std;
 
@@ -26,30 +31,120 @@ using namespace std;
 
 double const ratio_thresh = 0.7;
 int const local_skip_points = 5;
+bool const contour_top_edge = true;	// Finds the top edge from the contour itself instead of drawing it
+int const top_edge_check_rows = 8;	// Rows swept between checks for whether every column was found
 
-int FindNthBiggestContour(const vector<vector<Point>>& contours, Rect& box, const int n, const int area);
+vector<vector<Point>> FindImageContours(const Mat& object);
+vector<ContourCandidate> SelectHandCandidates(const vector<vector<Point>>& contours, const int area);
+void FindTopEdge(const vector<Point>& contour, const Rect& box, vector<int>& top, vector<Point>& points);
 
 
+// TopEdgeRow
+// Precondition: row points to width pixels of a binary image, top points to width values where the
+//               columns whose edge is not found yet are USHRT_MAX
+// Postcondition: Every column not found yet whose pixel in row is 255 (white) is set to y
+static void TopEdgeRow(const uchar* row, const int y, ushort* top, const int width) {
+	int col = 0;
+#ifdef HAND_SSE2
+	const __m128i white = _mm_set1_epi8(char(255));
+	const __m128i unset = _mm_set1_epi16(short(USHRT_MAX));
+	const __m128i y_v = _mm_set1_epi16(short(y));
+	for (; col + 16 <= width; col += 16) {
+		__m128i hit = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(row + col)), white);
+		if (_mm_movemask_epi8(hit) == 0) continue;
+
+		__m128i top_low = _mm_loadu_si128((const __m128i*)(top + col));
+		__m128i top_high = _mm_loadu_si128((const __m128i*)(top + col + 8));
+		__m128i set_low = _mm_and_si128(_mm_unpacklo_epi8(hit, hit), _mm_cmpeq_epi16(top_low, unset));
+		__m128i set_high = _mm_and_si128(_mm_unpackhi_epi8(hit, hit), _mm_cmpeq_epi16(top_high, unset));
+		top_low = _mm_or_si128(_mm_andnot_si128(set_low, top_low), _mm_and_si128(set_low, y_v));
+		top_high = _mm_or_si128(_mm_andnot_si128(set_high, top_high), _mm_and_si128(set_high, y_v));
+		_mm_storeu_si128((__m128i*)(top + col), top_low);
+		_mm_storeu_si128((__m128i*)(top + col + 8), top_high);
+	}
+#endif
+	for (; col < width; col++) {
+		if (row[col] == 255 && top[col] == USHRT_MAX) top[col] = ushort(y);
+	}
+}
+
 // Finds the upper edge of the given object by finding which pixels have a value of 255 (white)
 // Preconditions: object is of the correct type and is correctly allocated
-// Postconditions: Returns a vector of points of the found top edges
+// Postconditions: Returns a vector of points of the found top edges, one every local_skip_points
+//                 columns. The object is swept a row at a time, stopping once every column is found.
 vector<Point> FindTopEdge(const Mat& object) {
+	vector<ushort> top(object.cols, USHRT_MAX);
+	for (int j = 0; j < object.rows; j++) {
+		TopEdgeRow(object.ptr<uchar>(j), j, top.data(), object.cols);
+		if ((j + 1) % top_edge_check_rows == 0) {
+			bool found_all = true;
+			for (int i = 0; i < object.cols && found_all; i += local_skip_points) {
+				found_all = (top[i] != USHRT_MAX);
+			}
+			if (found_all) break;
+		}
+	}
+
 	vector<Point> points;
 	for (int i = 0; i < object.cols; i += local_skip_points) {
-		for (int j = 0; j < object.rows; j++) {
-			if (object.at<uchar>(j, i) == 255) { // White here
-				points.push_back(Point(i, j));
-				break;
+		if (top[i] != USHRT_MAX) points.push_back(Point(i, top[i]));
+	}
+	return points;
+}
+
+// Finds the upper edge of the given contour straight from its points, without drawing it
+// Preconditions: contour is of the correct type and box is its bounding box
+// Postconditions: Returns the same points as FindTopEdge on the contour filled in and cut to box.
+//                 For every edge of the contour, each column it crosses keeps its smallest y.
+vector<Point> FindTopEdge(const vector<Point>& contour, const Rect& box) {
+	vector<int> top;
+	vector<Point> points;
+	FindTopEdge(contour, box, top, points);
+	return points;
+}
+
+// Finds the upper edge of the given contour straight from its points, without drawing it
+// Preconditions: contour is of the correct type and box is its bounding box
+// Postconditions: points holds what FindTopEdge returns for contour. top is used for the edge of each
+//                 column, top and points keep their memory between calls.
+void FindTopEdge(const vector<Point>& contour, const Rect& box, vector<int>& top, vector<Point>& points) {
+	int const columns = (box.width + local_skip_points - 1) / local_skip_points;
+	top.assign(columns, INT_MAX);
+	for (int k = 0; k < (int)contour.size(); k++) {
+		Point start = contour[k] - box.tl();
+		Point end = contour[(k + 1) % contour.size()] - box.tl();
+		if (end.x < start.x) swap(start, end);
+
+		// First sampled column at or after the start of the edge
+		int first = (start.x + local_skip_points - 1) / local_skip_points;
+		for (int i = first; i < columns && i * local_skip_points <= end.x; i++) {
+			int x = i * local_skip_points;
+			int y = min(start.y, end.y);
+			if (end.x != start.x) {
+				// Lowest y of the edge inside the pixel, the chain approximation only leaves
+				//  straight, upright and 45 degree edges, where this is the drawn pixel exactly
+				double slope = double(end.y - start.y) / (end.x - start.x);
+				double left = max(double(start.x), x - 0.5);
+				double right = min(double(end.x), x + 0.5);
+				double lowest = start.y + slope * ((slope < 0 ? right : left) - start.x);
+				y = (int)floor(lowest + 0.5);
 			}
+			top[i] = min(top[i], y);
 		}
 	}
-	return points;
+
+	points.clear();
+	for (int i = 0; i < columns; i++) {
+		if (top[i] != INT_MAX) points.push_back(Point(i * local_skip_points, top[i]));
+	}
 }
 
 // Credit: Original local minima and maxima algorithm by GeeksforGeeks, but has
 //         since been heavily modified and added to
+//         Only the minima and maxima above middle are counted, none are stored.
 int FindLocalMaximaMinima(const vector<Point>& points, const int middle) {
-	vector<int> max, min;
+	int true_minima = 0;
+	int true_maxima = 0;
 	for (int i = 1; i < points.size() - 1; i++) {
 		bool skip = false;
 		int next = i + 1;
@@ -68,14 +163,16 @@ int FindLocalMaximaMinima(const vector<Point>& points, const int middle) {
 			skip = true;
 		}
 
-		// Condition for local minima 
+		// Condition for local minima, which must be smaller than middle
 		if ((points[prev].y > points[i].y) and
-			(points[i].y < points[next].y))
-			min.push_back(i);
-		// Condition for local maxima 
+			(points[i].y < points[next].y)) {
+			if (middle > points[i].y) true_minima++;
+		}
+		// Condition for local maxima, which must be smaller than middle
 		else if ((points[prev].y < points[i].y) and
-			(points[i].y > points[next].y))
-			max.push_back(i);
+			(points[i].y > points[next].y)) {
+			if (middle > points[i].y) true_maxima++;
+		}
 
 		if (skip) {
 			i++;
@@ -84,37 +181,27 @@ int FindLocalMaximaMinima(const vector<Point>& points, const int middle) {
 	}
 
 	//If equal in the start/end
+	bool const above_end = middle > points[points.size() - 2].y;
 	if (points[points.size() - 1].y == points[points.size() - 2].y) {
 		if (points[points.size() - 2].y < points[points.size() - 3].y)
-			min.push_back((int)points.size() - 2);
-		else max.push_back((int)points.size() - 2);
+			true_minima += above_end;
+		else true_maxima += above_end;
 	}
+	bool const above_start = middle > points[1].y;
 	if (points[0].y == points[1].y) {
 		if (points[1].y < points[2].y)
-			min.push_back(1);
-		else max.push_back(1);
-	}
-
-	// Local min and max must be smaller than middle
-	vector<int> true_minima;
-	vector<int> true_maxima;
-	for (int i = 0; i < min.size(); i++) {
-		if (middle > points[min[i]].y)
-			true_minima.push_back(min[i]);
-	}
-	for (int i = 0; i < max.size(); i++) {
-		if (middle > points[max[i]].y)
-			true_maxima.push_back(max[i]);
+			true_minima += above_start;
+		else true_maxima += above_start;
 	}
 
 	// Final Check
-	if (true_minima.size() == 1) return 1;
-	if (true_minima.size() > 0 && true_minima.size() < 6 &&
-		true_maxima.size() > 0 && true_maxima.size() < 6) {
-		if (true_minima.size() == true_maxima.size())
-			return ((int)true_maxima.size() + 1);
-		else if ((int)true_minima.size() - true_maxima.size() == 1)
-			return (int)true_minima.size();
+	if (true_minima == 1) return 1;
+	if (true_minima > 0 && true_minima < 6 &&
+		true_maxima > 0 && true_maxima < 6) {
+		if (true_minima == true_maxima)
+			return (true_maxima + 1);
+		else if (true_minima - true_maxima == 1)
+			return true_minima;
 	}
 	return -1;
 }
@@ -123,24 +210,44 @@ int FindLocalMaximaMinima(const vector<Point>& points, const int middle) {
 
 
 
+// ScratchObject
+// Precondition: scratch is correctly allocated, size is the size of the object to draw
+// Postcondition: Returns a zeroed view of size from the top left of scratch.object, which is only
+//                reallocated when it is smaller than size in either direction
+Mat ScratchObject(DetectorScratch& scratch, const Size& size) {
+	if (scratch.object.rows < size.height || scratch.object.cols < size.width) {
+		scratch.object.create(max(scratch.object.rows, size.height), max(scratch.object.cols, size.width), CV_8U);
+	}
+	Mat object = scratch.object(Rect(0, 0, size.width, size.height));
+	object.setTo(Scalar::all(0));
+	return object;
+}
+
 // SearchForHand
-// Preconditions: The functions FindNthBiggestContour and FindLocalMaximaMinima exist and are fully 
-//                implemented. front is a binary image. List of contours must already be computed for front.
+// Preconditions: The function FindLocalMaximaMinima exists and is fully implemented. contours must
+//                already be computed for a binary image and candidates picked from them.
 // Postconditions: A hand object is returned with the following values: the type and the x and y
-//                 location coordinates. If a hand is not detected all hand values are -1.
-Hand SearchForHand(const Mat& front, const vector<vector<Point>>& contours, Rect& box) {
+//                 location coordinates. If a hand is not detected all hand values are -1. Candidates
+//                 are tried biggest first. Their top edge comes from the contour, or with
+//                 contour_top_edge off from drawing it inside its box into scratch's buffer.
+Hand SearchForHand(const vector<vector<Point>>& contours, const vector<ContourCandidate>& candidates,
+	Rect& box, DetectorScratch& scratch) {
 	Hand hand;
-	Mat only_object;
-	for (int i = 1; i <= contours.size(); i++) {
-		int contour_index = FindNthBiggestContour(contours, box, i, (front.rows * front.cols));
-		if (contour_index == -1) {
-			break;
+	for (int i = 0; i < (int)candidates.size(); i++) {
+		box = candidates[i].box;
+		vector<Point>& top_edge = scratch.top_edge;
+		if (contour_top_edge) {
+			FindTopEdge(contours[candidates[i].index], box, scratch.top, top_edge);
+		}
+		else {
+			// Same pixels as drawing into a full frame and taking pic(box), the offset moves box to 0, 0
+			Mat only_object = ScratchObject(scratch, box.size());
+			drawContours(only_object, contours, candidates[i].index, Scalar(255, 255, 255), FILLED, LINE_8,
+				noArray(), INT_MAX, Point(-box.x, -box.y));
+			top_edge = FindTopEdge(only_object);
 		}
-		Mat pic(front.rows, front.cols, CV_8U, Scalar::all(0));
-		drawContours(pic, contours, contour_index, Scalar(255, 255, 255), FILLED);
-		only_object = pic(box);
 
-		int type = FindLocalMaximaMinima(FindTopEdge(only_object), (only_object.rows / 2));
+		int type = FindLocalMaximaMinima(top_edge, (box.height / 2));
 
 		if (type != -1) {
 			hand.type = type;
@@ -151,3 +258,32 @@ Hand SearchForHand(const Mat& front, const vector<vector<Point>>& contours, Rect
 	}
 	return hand;
 }
+
+// SearchForHand
+// Preconditions: front is a binary image. List of contours must already be computed for front.
+// Postconditions: Same as the SearchForHand above, picking the candidates itself and using a
+//                 scratch buffer of its own
+Hand SearchForHand(const Mat& front, const vector<vector<Point>>& contours, Rect& box) {
+	DetectorScratch scratch;
+	return SearchForHand(contours, SelectHandCandidates(contours, front.rows * front.cols), box, scratch);
+}
+
+// RefineHand
+// Preconditions: object is a full resolution binary mask around where a hand was found at a lower
+//                resolution
+// Postconditions: box is set to the biggest contour of object. If refine_type is set, the hand type
+//                 is counted again from that contour when a count can be made. Returns false and
+//                 leaves hand and box alone if object has no contour.
+bool RefineHand(const Mat& object, Hand& hand, Rect& box, const bool refine_type) {
+	if (object.empty()) return false;
+	vector<vector<Point>> contours = FindImageContours(object);
+	vector<ContourCandidate> candidates = SelectHandCandidates(contours, 0);
+	if (candidates.empty()) return false;
+
+	box = candidates[0].box;
+	if (refine_type && box.width >= 3 * local_skip_points) {
+		int type = FindLocalMaximaMinima(FindTopEdge(contours[candidates[0].index], box), (box.height / 2));
+		if (type != -1) hand.type = type;
+	}
+	return true;
+}
@@ -0,0 +1,47 @@
+// Contains the row band executor for Hand Detection. The per pixel loops split an image's rows into
+//  bands and run each band on OpenCV's thread pool, whose size is set with SetWorkerThreads. Only
+//  needs OpenCV's core, so the older copies of the project outside Updated share it too.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#pragma once
+#include <algorithm>
+#include <opencv2/core.hpp>
+
+int const bands_per_thread = 4;
+
+// SetWorkerThreads
+// Precondition: threads is the number of threads to use, 0 or less uses one per core
+// Postcondition: The row band loops and OpenCV's own functions will use up to threads threads
+inline void SetWorkerThreads(int const threads) {
+	cv::setNumThreads(threads > 0 ? threads : -1);
+}
+
+// RowBands
+// Precondition: rows is at least 0
+// Postcondition: Returns how many bands rows should be split into, a few per thread so a slow band
+//                does not hold up the rest
+inline int RowBands(int const rows) {
+	return std::max(1, std::min(rows, cv::getNumThreads() * bands_per_thread));
+}
+
+// ParallelRowBands
+// Precondition: body(band, start_row, end_row) can be run on several threads at once
+// Postcondition: body has been run once for each of bands bands, which together cover rows 0 to rows
+template <typename Body>
+void ParallelRowBands(int const rows, int const bands, const Body& body) {
+	cv::parallel_for_(cv::Range(0, bands), [&](const cv::Range& range) {
+		for (int band = range.start; band < range.end; band++) {
+			body(band, band * rows / bands, (band + 1) * rows / bands);
+		}
+	}, bands);
+}
+
+// ParallelRows
+// Precondition: body(start_row, end_row) can be run on several threads at once
+// Postcondition: body has been run over bands of rows that together cover rows 0 to rows
+template <typename Body>
+void ParallelRows(int const rows, const Body& body) {
+	ParallelRowBands(rows, RowBands(rows), [&](int, int start_row, int end_row) {
+		body(start_row, end_row);
+	});
+}
@@ -0,0 +1,184 @@
+// Contains the multithreaded frame pipeline for Hand Detection. Frames are decoded on one thread,
+//  analyzed by a pool of workers, put back in order so the movement direction can be worked out one
+//  frame after another, and then encoded on their own thread.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#include <opencv2/core.hpp>
+#include <opencv2/highgui.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/features2d.hpp>
+#include <iostream>
+#include <cmath>
+#include <opencv2/core/types.hpp>
+#include <vector>
+#include <stdlib.h>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/videoio.hpp>
+#include <opencv2/video.hpp>
+#include "Hand.h"
+#include "Pipeline.h"
+using namespace cv;
+using namespace std;
+
+int const pipeline_queue_size = 32;
+int const pipeline_window = 64;
+
+void PrepareImage(Mat& image);
+void BackgroundRemover(const Mat& front, const Mat& back, Mat& output);
+void FindImageContours(const Mat& object, vector<vector<Point>>& contours, DetectorScratch& scratch);
+void SelectHandCandidates(const vector<vector<Point>>& contours, const int area,
+	vector<ContourCandidate>& candidates);
+void ExtractHandCandidates(const Mat& mask, const int area, vector<vector<Point>>& contours,
+	vector<ContourCandidate>& candidates, DetectorScratch& scratch);
+Hand SearchForHand(const vector<vector<Point>>& contours, const vector<ContourCandidate>& candidates,
+	Rect& box, DetectorScratch& scratch);
+int HandMovementDirection(const Hand& current, const Hand& previous);
+void DrawHandInfo(Mat& frame, const Hand& hand, const int shape_type, const Rect& box);
+
+
+// AnalyzeJob
+// Precondition: job holds a colored frame, background is the prepared background of the video
+// Postcondition: job's hand and box are set from searching its frame, with the candidates taken from
+//                the mask's connected components when components is set and from all of its contours
+//                otherwise. The frame itself is left as it was read so it can still be drawn on. front
+//                and scratch are the worker's buffers.
+void AnalyzeJob(FrameJob& job, const Mat& background, const bool components, Mat& front,
+	DetectorScratch& scratch) {
+	Mat prepared = job.frame.clone();
+	PrepareImage(prepared);
+	BackgroundRemover(prepared, background, front);
+
+	vector<vector<Point>> contours;
+	vector<ContourCandidate> candidates;
+	if (components) ExtractHandCandidates(front, front.rows * front.cols, contours, candidates, scratch);
+	else {
+		FindImageContours(front, contours, scratch);
+		SelectHandCandidates(contours, front.rows * front.cols, candidates);
+	}
+	job.hand = SearchForHand(contours, candidates, job.box, scratch);
+}
+
+// RunPipeline
+// Precondition: video is open at its first frame, background is its prepared background, output is
+//               open with the video's frame size. skip and threads are at least 1.
+// Postcondition: Every frame of video is written to output in its original order, analyzing every
+//                skip-th frame on threads worker threads and drawing the hand info the way the single
+//                threaded loop does. Frames are analyzed out of order, so unlike that loop the whole
+//                frame is searched at full size against the extracted background, each with its own
+//                contrast mean. There is no online background model, tracked region, pyramid, adaptive
+//                schedule, run length mask or mask recording. components picks how hand candidates are
+//                found, as in AnalyzeJob. Returns the number of frames written.
+int RunPipeline(VideoCapture& video, const Mat& background, VideoWriter& output, int const skip,
+	int const threads, const bool components) {
+	BoundedQueue<FrameJob> decoded(pipeline_queue_size);
+	BoundedQueue<FrameJob> analyzed(pipeline_queue_size);
+	BoundedQueue<FrameJob> annotated(pipeline_queue_size);
+	atomic<int> emitted(0);
+	mutex emitted_lock;
+	condition_variable emitted_changed;
+
+	// Decode, staying at most pipeline_window frames ahead of the frames already put in order
+	thread decoder([&]() {
+		int index = 0;
+		while (true) {
+			if (index - emitted.load(memory_order_acquire) >= pipeline_window) {
+				unique_lock<mutex> lock(emitted_lock);
+				emitted_changed.wait(lock, [&]() {
+					return index - emitted.load(memory_order_acquire) < pipeline_window;
+				});
+			}
+			FrameJob job;
+			video >> job.frame;
+			if (job.frame.empty()) break;
+			job.index = index;
+			job.analyzed = ((index + 1) % skip == 0);
+			decoded.Push(job);
+			index++;
+		}
+		for (int i = 0; i < threads; i++) {
+			FrameJob stop;
+			decoded.Push(stop);
+		}
+	});
+
+	// Prepare, remove the background and search for the hand, in whatever order frames come in
+	vector<thread> workers;
+	for (int i = 0; i < threads; i++) {
+		workers.emplace_back([&]() {
+			Mat front;
+			DetectorScratch scratch;
+			FrameJob job;
+			while (true) {
+				decoded.Pop(job);
+				if (job.index < 0) break;
+				if (job.analyzed) {
+					AnalyzeJob(job, background, components, front, scratch);
+				}
+				analyzed.Push(job);
+			}
+			analyzed.Push(job);		// Tells the reorder loop this worker is done
+		});
+	}
+
+	thread encoder([&]() {
+		FrameJob job;
+		while (true) {
+			annotated.Pop(job);
+			if (job.index < 0) break;
+			output.write(job.frame);
+		}
+	});
+
+	// Put frames back in order and draw on them, the movement direction depends on the previous hand
+	vector<FrameJob> reorder(pipeline_window);
+	vector<bool> ready(pipeline_window, false);
+	Hand previous_hand;
+	int previous_shape_type = -1;
+	Rect prev_box;
+	int next = 0;
+	int finished_workers = 0;
+	while (finished_workers < threads) {
+		FrameJob job;
+		analyzed.Pop(job);
+		if (job.index < 0) {
+			finished_workers++;		// Every frame a worker had is already in the queue before its stop
+			continue;
+		}
+		int const slot = job.index % pipeline_window;
+		reorder[slot] = move(job);
+		ready[slot] = true;
+
+		while (ready[next % pipeline_window]) {
+			FrameJob& current = reorder[next % pipeline_window];
+			if (current.analyzed) {
+				int shape_type = HandMovementDirection(current.hand, previous_hand);
+				DrawHandInfo(current.frame, current.hand, shape_type, current.box);
+				if (current.hand.type != -1) {
+					prev_box = current.box;
+				}
+				previous_shape_type = shape_type;
+				previous_hand = current.hand;
+			}
+			else {
+				DrawHandInfo(current.frame, previous_hand, previous_shape_type, prev_box);
+			}
+			ready[next % pipeline_window] = false;
+			annotated.Push(current);
+			next++;
+			emitted.store(next, memory_order_release);
+		}
+		{
+			lock_guard<mutex> lock(emitted_lock);	// The decoder is either asleep or has not checked yet
+		}
+		emitted_changed.notify_one();
+	}
+
+	FrameJob stop;
+	annotated.Push(stop);
+	decoder.join();
+	for (int i = 0; i < threads; i++) {
+		workers[i].join();
+	}
+	encoder.join();
+	return next;
+}
@@ -0,0 +1,148 @@
+// Contains the pieces shared by the multithreaded frame pipeline for Hand Detection. FrameJob is one
+//  frame moving through the pipeline and BoundedQueue is the lock-free queue between its stages.
+//  A stage that finds its queue empty or full spins briefly and then sleeps until the other side moves.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "Hand.h"
+
+int const queue_spin_tries = 64;	// Tries before a blocked Push or Pop sleeps on its condition
+
+struct FrameJob {
+	int index = -1;			// Position in the video, -1 tells the stage reading it to stop
+	bool analyzed = false;	// Whether the hand is searched for in this frame
+	Mat frame;
+	Hand hand;
+	Rect box;
+};
+
+// Fixed size multi-producer multi-consumer queue. Each cell carries a sequence number that says
+// whether it is ready to be written or read, so pushing and popping only need a compare and swap
+// on the shared position. capacity must be a power of 2. Push and Pop sleep once spinning has not
+// helped, and every successful push or pop wakes whoever is asleep on the other side. A sleeper
+// counts itself before trying once more, so a wake up can not be missed.
+template <typename T>
+class BoundedQueue {
+public:
+	explicit BoundedQueue(size_t capacity) : cells(new Cell[capacity]), mask(capacity - 1) {
+		for (size_t i = 0; i < capacity; i++) {
+			cells[i].sequence.store(i, memory_order_relaxed);
+		}
+		enqueue_pos.store(0, memory_order_relaxed);
+		dequeue_pos.store(0, memory_order_relaxed);
+	}
+
+	// Adds item and returns true, or returns false without touching item when the queue is full
+	bool TryPush(T& item) {
+		if (!TryPushItem(item)) return false;
+		Wake(pop_waiters, not_empty);
+		return true;
+	}
+
+	// Moves the oldest item into item and returns true, or returns false when the queue is empty
+	bool TryPop(T& item) {
+		if (!TryPopItem(item)) return false;
+		Wake(push_waiters, not_full);
+		return true;
+	}
+
+	// Waits for room and then adds item
+	void Push(T& item) {
+		for (int i = 0; i < queue_spin_tries; i++) {
+			if (TryPush(item)) return;
+			this_thread::yield();
+		}
+		{
+			unique_lock<mutex> lock(wait_lock);
+			push_waiters.fetch_add(1);
+			atomic_thread_fence(memory_order_seq_cst);
+			while (!TryPushItem(item)) not_full.wait(lock);
+			push_waiters.fetch_sub(1);
+		}
+		Wake(pop_waiters, not_empty);
+	}
+
+	// Waits for an item and then moves it into item
+	void Pop(T& item) {
+		for (int i = 0; i < queue_spin_tries; i++) {
+			if (TryPop(item)) return;
+			this_thread::yield();
+		}
+		{
+			unique_lock<mutex> lock(wait_lock);
+			pop_waiters.fetch_add(1);
+			atomic_thread_fence(memory_order_seq_cst);
+			while (!TryPopItem(item)) not_empty.wait(lock);
+			pop_waiters.fetch_sub(1);
+		}
+		Wake(push_waiters, not_full);
+	}
+
+private:
+	struct Cell {
+		atomic<size_t> sequence;
+		T data;
+	};
+
+	// The lock-free push, without waking anyone
+	bool TryPushItem(T& item) {
+		Cell* cell;
+		size_t pos = enqueue_pos.load(memory_order_relaxed);
+		while (true) {
+			cell = &cells[pos & mask];
+			size_t sequence = cell->sequence.load(memory_order_acquire);
+			intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+			if (diff == 0) {
+				if (enqueue_pos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) break;
+			}
+			else if (diff < 0) return false;
+			else pos = enqueue_pos.load(memory_order_relaxed);
+		}
+		cell->data = move(item);
+		cell->sequence.store(pos + 1, memory_order_release);
+		return true;
+	}
+
+	// The lock-free pop, without waking anyone
+	bool TryPopItem(T& item) {
+		Cell* cell;
+		size_t pos = dequeue_pos.load(memory_order_relaxed);
+		while (true) {
+			cell = &cells[pos & mask];
+			size_t sequence = cell->sequence.load(memory_order_acquire);
+			intptr_t diff = (intptr_t)sequence - (intptr_t)(pos + 1);
+			if (diff == 0) {
+				if (dequeue_pos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) break;
+			}
+			else if (diff < 0) return false;
+			else pos = dequeue_pos.load(memory_order_relaxed);
+		}
+		item = move(cell->data);
+		cell->sequence.store(pos + mask + 1, memory_order_release);
+		return true;
+	}
+
+	// Wakes the threads asleep on condition, if waiters says there are any
+	void Wake(atomic<int>& waiters, condition_variable& condition) {
+		atomic_thread_fence(memory_order_seq_cst);
+		if (waiters.load(memory_order_relaxed) == 0) return;
+		lock_guard<mutex> lock(wait_lock);
+		condition.notify_all();
+	}
+
+	unique_ptr<Cell[]> cells;
+	size_t const mask;
+	alignas(64) atomic<size_t> enqueue_pos;
+	alignas(64) atomic<size_t> dequeue_pos;
+	mutex wait_lock;
+	condition_variable not_empty;
+	condition_variable not_full;
+	atomic<int> push_waiters{0};
+	atomic<int> pop_waiters{0};
+};
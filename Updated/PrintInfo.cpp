@@ -8,13 +8,18 @@
 #include <opencv2/features2d.hpp>
 #include <iostream>
 #include <cmath>
+#include <climits>
 #include <opencv2/core/types.hpp>
 #include <vector>
+#include <stdio.h>
 #include <stdlib.h>
 #include <opencv2/imgcodecs.hpp>
 #include <opencv2/videoio.hpp>
 #include <opencv2/video.hpp>
 #include "Hand.h"
+#ifdef HAND_EMBED_HUD_ICONS
+#include "HudIcons.h"
+#endif
 using namespace cv;
 using namespace std;
 
@@ -25,63 +30,199 @@ using namespace std;
 #define MOVE_RIGHT 4;
 
 Scalar const text_color = { 0, 255, 0 };
+Scalar const box_color = Scalar{ 0, 0, 255 };
 int const movement_threshold = 11;
+int const hud_font = 1;
+double const hud_font_scale = 1.5;
+int const hud_thickness = 2;
+int const hud_label_cache_size = 32;
 
+// The movement direction icons, decoded and rotated once
+struct HudAssets {
+	Mat none;
+	Mat stay;
+	Mat arrows[4];	// Right, down, up, left, the same order as the movement directions
+};
+
+// A line of text drawn once, and copied into each frame that shows it
+struct HudLabel {
+	string text;
+	double scale = 0;
+	Scalar color;
+	Mat canvas;		// What the text is drawn on, only grows when the label is reused for other text
+	Mat mask;		// The part of canvas the text covers
+	Point offset;	// From where the text starts to the top left of mask
+};
+
+
+// HudLabelFor
+// Precondition: text is the text to draw, scale and color are what putText would be given
+// Postcondition: Returns the label for the text, which is only drawn the first time the thread asks
+//                for it. Once hud_label_cache_size are kept the least recently made label is redrawn
+//                with the text, reusing its strings and canvas.
+static const HudLabel& HudLabelFor(const string& text, const double scale, const Scalar& color) {
+	thread_local vector<HudLabel> labels;	// Each thread drawing its own video keeps its own
+	thread_local int oldest = 0;
+	thread_local vector<Point> covered;
+	for (int i = 0; i < (int)labels.size(); i++) {
+		if (labels[i].text == text && labels[i].scale == scale && labels[i].color == color) return labels[i];
+	}
+	if (labels.empty()) labels.reserve(hud_label_cache_size);
+	int slot = oldest;
+	if ((int)labels.size() < hud_label_cache_size) {
+		labels.push_back(HudLabel());
+		slot = (int)labels.size() - 1;
+	}
+	else oldest = (oldest + 1) % hud_label_cache_size;
+	HudLabel& label = labels[slot];
+
+	// Drawn with room to spare around it then cut down to the pixels the text covers, the glyphs can
+	//  reach past what getTextSize says
+	label.text = text;
+	label.scale = scale;
+	label.color = color;
+	label.mask = Mat();
+	int baseline = 0;
+	Size size = getTextSize(text, hud_font, scale, hud_thickness, &baseline);
+	int const pad = hud_thickness * 2;
+	Point origin(pad, size.height * 2 + pad);
+	Size const canvas_size(size.width + pad * 2, origin.y + baseline * 2 + pad);
+	if (label.canvas.rows < canvas_size.height || label.canvas.cols < canvas_size.width) {
+		label.canvas.create(max(label.canvas.rows, canvas_size.height), max(label.canvas.cols, canvas_size.width),
+			CV_8U);
+	}
+	Mat canvas = label.canvas(Rect(Point(0, 0), canvas_size));
+	canvas.setTo(Scalar::all(0));
+	putText(canvas, text, origin, hud_font, scale, Scalar(255), hud_thickness);
+
+	findNonZero(canvas, covered);
+	if (!covered.empty()) {
+		Rect ink = boundingRect(covered);
+		label.mask = canvas(ink);
+		label.offset = ink.tl() - origin;
+	}
+	return label;
+}
+
+// DrawHudLabel
+// Precondition: frame is a BGR image, the other parameters are what putText would be given
+// Postcondition: Puts the same pixels on frame as putText, as long as the text fits in the frame.
+//                The text's color is set through its cached label's mask.
+static void DrawHudLabel(Mat& frame, const string& text, const Point origin, const double scale,
+	const Scalar& color) {
+	const HudLabel& label = HudLabelFor(text, scale, color);
+	if (label.mask.empty()) return;
+	Rect place(origin + label.offset, label.mask.size());
+	Rect visible = place & Rect(0, 0, frame.cols, frame.rows);
+	if (visible.empty()) return;
+	Rect inside = visible - place.tl();
+	frame(visible).setTo(label.color, label.mask(inside));
+}
 
 // PrintHandLocation
 // Precondition: Parameters are properly formatted and passed in correctly
-// Postcondition: Will write the hand location on the passed in frame
+// Postcondition: Will write the hand location on the passed in frame. The text is only remade when
+//                the location changes.
 void PrintHandLocation(Mat& frame, const Point hand_pos) {
-	string hand_location = "Hand Location: (" + to_string(hand_pos.x) + ", " + to_string(hand_pos.y) + ")";
-	putText(frame, hand_location, Point{ 3, frame.rows - 6 }, 1, 1.5, text_color, 2);
+	thread_local Point last_pos(INT_MIN, INT_MIN);
+	thread_local string hand_location;
+	if (hand_pos != last_pos) {
+		char text[64];
+		snprintf(text, sizeof(text), "Hand Location: (%d, %d)", hand_pos.x, hand_pos.y);
+		hand_location.assign(text);		// Keeps the string's memory
+		last_pos = hand_pos;
+	}
+	DrawHudLabel(frame, hand_location, Point{ 3, frame.rows - 6 }, hud_font_scale, text_color);
+}
+
+#ifdef HAND_EMBED_HUD_ICONS
+// LoadHudIcon
+// Precondition: data and size are an icon's JPEG bytes built into the program
+// Postcondition: Returns the decoded icon, or an empty image if it can not be decoded
+static Mat LoadHudIcon(const unsigned char* data, const size_t size) {
+	return imdecode(Mat(1, (int)size, CV_8U, (void*)data), IMREAD_COLOR);
+}
+#else
+// LoadHudIcon
+// Precondition: file is the name of the icon in the code directory
+// Postcondition: Returns the decoded icon, or an empty image if it can not be read
+static Mat LoadHudIcon(const string& file) {
+	return imread(file);
+}
+#endif
+
+// HudAssetCache
+// Precondition: None
+// Postcondition: Returns the icons, which are decoded and rotated the first time it is called only
+static const HudAssets& HudAssetCache() {
+	static const HudAssets assets = [] {
+		HudAssets loaded;
+#ifdef HAND_EMBED_HUD_ICONS
+		loaded.none = LoadHudIcon(hud_none_jpg, sizeof(hud_none_jpg));
+		loaded.stay = LoadHudIcon(hud_stay_jpg, sizeof(hud_stay_jpg));
+		Mat arrow = LoadHudIcon(hud_arrow_jpg, sizeof(hud_arrow_jpg));
+#else
+		loaded.none = LoadHudIcon("none.jpg");
+		loaded.stay = LoadHudIcon("stay.jpg");
+		Mat arrow = LoadHudIcon("arrow.jpg");
+#endif
+		if (!arrow.empty()) {
+			loaded.arrows[0] = arrow;	//Right
+			rotate(arrow, loaded.arrows[1], ROTATE_90_CLOCKWISE);	//Down
+			rotate(arrow, loaded.arrows[2], ROTATE_90_COUNTERCLOCKWISE);	//Up
+			rotate(arrow, loaded.arrows[3], ROTATE_180);	//Left
+		}
+		return loaded;
+	}();
+	return assets;
+}
+
+// LoadHudAssets
+// Precondition: Called once at startup, before any frames are drawn
+// Postcondition: Decodes and rotates the icons up front. Returns false if one of them is missing.
+bool LoadHudAssets() {
+	const HudAssets& assets = HudAssetCache();
+	return !assets.none.empty() && !assets.stay.empty() && !assets.arrows[0].empty();
 }
 
 // MovementDirectionShape
 // Precondition: Parameter is properly formatted and passed in correctly
-// Postcondition: Will return an image based on the direction that was passed in
-Mat MovementDirectionShape(const int direction) {
-	Mat shape;
+// Postcondition: Will return an image based on the direction that was passed in, from the icons
+//                loaded up front so nothing is read or rotated per frame
+const Mat& MovementDirectionShape(const int direction) {
+	const HudAssets& assets = HudAssetCache();
 	if (direction == -1) {
-		shape = imread("none.jpg");
+		return assets.none;
 	}
 	else if (direction == 0) {
-		shape = imread("stay.jpg");
+		return assets.stay;
 	}
-	else {
-		shape = imread("arrow.jpg");
-		if (direction == 1) {	//Down
-			rotate(shape, shape, ROTATE_90_CLOCKWISE);
-		}
-		else if (direction == 2) {	//Up
-			rotate(shape, shape, ROTATE_90_COUNTERCLOCKWISE);
-		}
-		else if (direction == 3) {	//Left
-			rotate(shape, shape, ROTATE_180);
-		}
-		else {}	//Right
+	else if (direction == 1) {	//Down
+		return assets.arrows[1];
+	}
+	else if (direction == 2) {	//Up
+		return assets.arrows[2];
 	}
-	return shape;
+	else if (direction == 3) {	//Left
+		return assets.arrows[3];
+	}
+	return assets.arrows[0];	//Right
 }
 
 // Puts text on the screen representing the hand type detected
 // Preconditions: frame is of the correct type and correctly allocated, h_type is a constant integer
 // Postconditions: A window with text representing the hand position matched is put on the screen
 void PrintHandType(Mat& frame, const int h_type) {
-	string type;
-	if (h_type == 1)
-		type = "1 Finger Up";
-	else if (h_type == 2)
-		type = "2 Fingers Up";
-	else if (h_type == 3)
-		type = "3 Fingers Up";
-	else if (h_type == 4)
-		type = "4 Fingers Up";
-	else if (h_type == 5)
-		type = "5 Fingers Up";
-	else
-		type = "No Hand Detected";
-	string hand_type = "Hand Type: " + type;
-	putText(frame, hand_type, Point{ 3, frame.rows - 30 }, 1, 1.5, text_color, 2);
+	static const string hand_types[6] = {
+		"Hand Type: No Hand Detected",
+		"Hand Type: 1 Finger Up",
+		"Hand Type: 2 Fingers Up",
+		"Hand Type: 3 Fingers Up",
+		"Hand Type: 4 Fingers Up",
+		"Hand Type: 5 Fingers Up"
+	};
+	int type = (h_type >= 1 && h_type <= 5) ? h_type : 0;
+	DrawHudLabel(frame, hand_types[type], Point{ 3, frame.rows - 30 }, hud_font_scale, text_color);
 }
 
 // HandMovementDirection
@@ -112,3 +253,17 @@ int HandMovementDirection(const Hand& current, const Hand& previous) {
 	}
 	return STAYING_STILL;
 }
+
+// DrawHandInfo
+// Precondition: Parameters are properly formatted and passed in correctly
+// Postcondition: Will write the hand type and location on the passed in frame, put the movement
+//                direction shape in its corner and draw box around the hand if there is one
+void DrawHandInfo(Mat& frame, const Hand& hand, const int shape_type, const Rect& box) {
+	PrintHandType(frame, hand.type);
+	PrintHandLocation(frame, hand.location);
+	const Mat& shape = MovementDirectionShape(shape_type);
+	shape.copyTo(frame(Rect(0, 0, shape.cols, shape.rows)));
+	if (hand.type != -1) {
+		rectangle(frame, box, box_color, 2);
+	}
+}
@@ -0,0 +1,280 @@
+// Contains the run length mask operations for Hand Detection. Such as encoding a row of a binary mask
+//  into runs, measuring the mask's area, box and top edge straight from its runs, labelling its
+//  connected components by merging touching runs, and saving masks to a file to look at or replay.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#include <opencv2/core.hpp>
+#include <string.h>
+#include <climits>
+#include "RunMask.h"
+using namespace cv;
+using namespace std;
+
+char const run_mask_magic[4] = {'H', 'R', 'L', 'E'};
+
+// ClearRunMask
+// Precondition: None
+// Postcondition: mask is an empty mask of size, keeping the memory of its lists
+void ClearRunMask(RunMask& mask, const Size& size) {
+	mask.size = size;
+	mask.runs.clear();
+	mask.row_start.assign(size.height + 1, 0);
+}
+
+// AppendMaskRuns
+// Precondition: row points to width bytes that are 0 where the mask is clear
+// Postcondition: The runs of set bytes in row are added to the end of runs, left to right. Returns
+//                how many were added.
+int AppendMaskRuns(vector<MaskRun>& runs, const uchar* row, int const width) {
+	int const before = (int)runs.size();
+	int col = 0;
+	while (col < width) {
+		// Most of a hand mask is clear, skip it 8 bytes at a time
+		uint64 word;
+		while (col + 8 <= width && (memcpy(&word, row + col, 8), word == 0)) col += 8;
+		while (col < width && row[col] == 0) col++;
+		if (col == width) break;
+
+		MaskRun run;
+		run.start = col;
+		while (col < width && row[col] != 0) col++;
+		run.end = col;
+		runs.push_back(run);
+	}
+	return (int)runs.size() - before;
+}
+
+// EncodeRunMask
+// Precondition: dense is a binary CV_8U image
+// Postcondition: mask holds the runs of dense
+void EncodeRunMask(const Mat& dense, RunMask& mask) {
+	ClearRunMask(mask, dense.size());
+	for (int row = 0; row < dense.rows; row++) {
+		mask.row_start[row + 1] = mask.row_start[row] + AppendMaskRuns(mask.runs, dense.ptr<uchar>(row), dense.cols);
+	}
+}
+
+// RunMaskArea
+// Precondition: None
+// Postcondition: Returns the number of set pixels in mask
+int RunMaskArea(const RunMask& mask) {
+	int area = 0;
+	for (int i = 0; i < (int)mask.runs.size(); i++) area += mask.runs[i].end - mask.runs[i].start;
+	return area;
+}
+
+// RunMaskBounds
+// Precondition: None
+// Postcondition: Returns the smallest box holding every set pixel of mask, empty if none are set
+Rect RunMaskBounds(const RunMask& mask) {
+	int top = -1;
+	int bottom = -1;
+	int left = mask.size.width;
+	int right = 0;
+	for (int row = 0; row < mask.size.height; row++) {
+		int const first = mask.row_start[row];
+		int const last = mask.row_start[row + 1];
+		if (first == last) continue;
+		if (top < 0) top = row;
+		bottom = row;
+		left = min(left, mask.runs[first].start);		// A row's runs are left to right
+		right = max(right, mask.runs[last - 1].end);
+	}
+	if (top < 0) return Rect();
+	return Rect(left, top, right - left, bottom - top + 1);
+}
+
+// RunMaskTopEdge
+// Precondition: None
+// Postcondition: top has one entry per column of mask, the first row set in that column or -1 if the
+//                column is clear. Stops reading runs once every column has been found.
+void RunMaskTopEdge(const RunMask& mask, vector<int>& top) {
+	top.assign(mask.size.width, -1);
+	int left = mask.size.width;
+	for (int row = 0; row < mask.size.height && left > 0; row++) {
+		for (int i = mask.row_start[row]; i < mask.row_start[row + 1]; i++) {
+			for (int col = mask.runs[i].start; col < mask.runs[i].end; col++) {
+				if (top[col] < 0) {
+					top[col] = row;
+					left--;
+				}
+			}
+		}
+	}
+}
+
+// Follows parent links from run to the first run of its group, halving the path on the way
+static int RootRun(vector<int>& parent, int run) {
+	while (parent[run] != run) {
+		parent[run] = parent[parent[run]];
+		run = parent[run];
+	}
+	return run;
+}
+
+// LabelRunMask
+// Precondition: None
+// Postcondition: labels has the component of each run of mask, runs that touch in the row above or
+//                below, diagonals included, share one. components has one entry per component with
+//                its index as the label, its area, box and centroid. Returns the number of components.
+int LabelRunMask(const RunMask& mask, vector<int>& labels, vector<ContourCandidate>& components) {
+	int const count = (int)mask.runs.size();
+	labels.resize(count);
+	for (int i = 0; i < count; i++) labels[i] = i;
+
+	// Merge each run with the runs touching it in the row above. A group's root is its first run.
+	for (int row = 1; row < mask.size.height; row++) {
+		int above = mask.row_start[row - 1];
+		int below = mask.row_start[row];
+		int const above_end = mask.row_start[row];
+		int const below_end = mask.row_start[row + 1];
+		while (above < above_end && below < below_end) {
+			const MaskRun& a = mask.runs[above];
+			const MaskRun& b = mask.runs[below];
+			if (a.start <= b.end && b.start <= a.end) {
+				int const a_root = RootRun(labels, above);
+				int const b_root = RootRun(labels, below);
+				if (a_root != b_root) labels[max(a_root, b_root)] = min(a_root, b_root);
+			}
+			if (a.end < b.end) above++;
+			else below++;
+		}
+	}
+
+	// Every parent comes before its run, so it already holds its component when the run is reached
+	components.clear();
+	for (int row = 0; row < mask.size.height; row++) {
+		for (int i = mask.row_start[row]; i < mask.row_start[row + 1]; i++) {
+			const MaskRun& run = mask.runs[i];
+			int const length = run.end - run.start;
+			Rect const span(run.start, row, length, 1);
+			if (labels[i] == i) {
+				labels[i] = (int)components.size();
+				ContourCandidate component;
+				component.index = labels[i];
+				component.box = span;
+				components.push_back(component);
+			}
+			else {
+				labels[i] = labels[labels[i]];
+				components[labels[i]].box |= span;
+			}
+			ContourCandidate& component = components[labels[i]];
+			component.area += length;
+			component.centroid.x += (run.start + run.end - 1) * 0.5 * length;
+			component.centroid.y += (double)row * length;
+		}
+	}
+	for (int i = 0; i < (int)components.size(); i++) {
+		components[i].centroid.x /= components[i].area;
+		components[i].centroid.y /= components[i].area;
+	}
+	return (int)components.size();
+}
+
+// DrawRunMask
+// Precondition: dense is empty or a CV_8U image of mask's size, which may be a view
+// Postcondition: dense is the byte image of mask, 255 where it is set and 0 elsewhere
+void DrawRunMask(const RunMask& mask, Mat& dense) {
+	dense.create(mask.size, CV_8U);
+	dense.setTo(Scalar::all(0));
+	for (int row = 0; row < mask.size.height; row++) {
+		uchar* out = dense.ptr<uchar>(row);
+		for (int i = mask.row_start[row]; i < mask.row_start[row + 1]; i++) {
+			memset(out + mask.runs[i].start, 255, mask.runs[i].end - mask.runs[i].start);
+		}
+	}
+}
+
+// DrawRunComponent
+// Precondition: labels came from LabelRunMask for mask, box holds the runs of label and dense is a
+//               CV_8U image of box's size, which may be a view
+// Postcondition: dense is the part of mask inside box with only label's runs set to 255
+void DrawRunComponent(const RunMask& mask, const vector<int>& labels, int const label, const Rect& box,
+	Mat& dense) {
+	dense.setTo(Scalar::all(0));
+	for (int row = box.y; row < box.y + box.height; row++) {
+		uchar* out = dense.ptr<uchar>(row - box.y);
+		for (int i = mask.row_start[row]; i < mask.row_start[row + 1]; i++) {
+			if (labels[i] != label) continue;
+			memset(out + mask.runs[i].start - box.x, 255, mask.runs[i].end - mask.runs[i].start);
+		}
+	}
+}
+
+// Writes value 7 bits a byte, low bits first, with the top bit set on every byte but the last
+static void PutVarint(FILE* out, unsigned value) {
+	do {
+		int byte = value & 0x7f;
+		value >>= 7;
+		if (value != 0) byte |= 0x80;
+		fputc(byte, out);
+	} while (value != 0);
+}
+
+// Reads a value PutVarint wrote, returns false at the end of the file or on a value too long
+static bool GetVarint(FILE* in, unsigned& value) {
+	value = 0;
+	for (int shift = 0; shift < 35; shift += 7) {
+		int const byte = fgetc(in);
+		if (byte == EOF) return false;
+		value |= (unsigned)(byte & 0x7f) << shift;
+		if ((byte & 0x80) == 0) return true;
+	}
+	return false;
+}
+
+// WriteRunMask
+// Precondition: out is open for writing in binary
+// Postcondition: mask is added to out as a tag, its size and then each row's number of runs followed
+//                by the gap before and the length of each run. Masks can be written one after another
+//                and read back in order. Returns false if out could not be written.
+bool WriteRunMask(FILE* out, const RunMask& mask) {
+	fwrite(run_mask_magic, 1, sizeof(run_mask_magic), out);
+	PutVarint(out, mask.size.width);
+	PutVarint(out, mask.size.height);
+	for (int row = 0; row < mask.size.height; row++) {
+		PutVarint(out, mask.row_start[row + 1] - mask.row_start[row]);
+		int previous_end = 0;
+		for (int i = mask.row_start[row]; i < mask.row_start[row + 1]; i++) {
+			PutVarint(out, mask.runs[i].start - previous_end);
+			PutVarint(out, mask.runs[i].end - mask.runs[i].start);
+			previous_end = mask.runs[i].end;
+		}
+	}
+	return ferror(out) == 0;
+}
+
+// ReadRunMask
+// Precondition: in is open for reading in binary, at a mask WriteRunMask wrote or the end of the file
+// Postcondition: mask holds the next mask of in. Returns false at the end of in, or if what is there
+//                is not a whole mask or has runs outside its size.
+bool ReadRunMask(FILE* in, RunMask& mask) {
+	char magic[sizeof(run_mask_magic)];
+	if (fread(magic, 1, sizeof(magic), in) != sizeof(magic)) return false;
+	if (memcmp(magic, run_mask_magic, sizeof(magic)) != 0) return false;
+	unsigned width;
+	unsigned height;
+	if (!GetVarint(in, width) || !GetVarint(in, height)) return false;
+	if (width > INT_MAX || height > INT_MAX) return false;
+
+	ClearRunMask(mask, Size(width, height));
+	for (int row = 0; row < (int)height; row++) {
+		unsigned runs;
+		if (!GetVarint(in, runs)) return false;
+		unsigned end = 0;
+		for (unsigned i = 0; i < runs; i++) {
+			unsigned gap;
+			unsigned length;
+			if (!GetVarint(in, gap) || !GetVarint(in, length)) return false;
+			if (length == 0 || (i > 0 && gap == 0) || gap > width - end || length > width - end - gap) return false;
+			MaskRun run;
+			run.start = end + gap;
+			run.end = run.start + length;
+			mask.runs.push_back(run);
+			end = run.end;
+		}
+		mask.row_start[row + 1] = (int)mask.runs.size();
+	}
+	return true;
+}
@@ -0,0 +1,31 @@
+// Contains the RunMask struct for Hand Detection. Struct holds a binary mask as the runs of set pixels
+//  in each row, so a mostly empty foreground mask costs its set spans instead of a byte per pixel.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#pragma once
+#include <stdio.h>
+#include "Hand.h"
+
+struct MaskRun {
+	int start;		// First set column
+	int end;		// One past the last set column
+};
+
+struct RunMask {
+	Size size;
+	vector<MaskRun> runs;		// Every row's runs left to right, the rows top to bottom
+	vector<int> row_start;		// Index in runs of each row's first run, and one past the last row
+};
+
+void ClearRunMask(RunMask& mask, const Size& size);
+int AppendMaskRuns(vector<MaskRun>& runs, const uchar* row, int const width);
+void EncodeRunMask(const Mat& dense, RunMask& mask);
+int RunMaskArea(const RunMask& mask);
+Rect RunMaskBounds(const RunMask& mask);
+void RunMaskTopEdge(const RunMask& mask, vector<int>& top);
+int LabelRunMask(const RunMask& mask, vector<int>& labels, vector<ContourCandidate>& components);
+void DrawRunMask(const RunMask& mask, Mat& dense);
+void DrawRunComponent(const RunMask& mask, const vector<int>& labels, int const label, const Rect& box,
+	Mat& dense);
+bool WriteRunMask(FILE* out, const RunMask& mask);
+bool ReadRunMask(FILE* in, RunMask& mask);
@@ -0,0 +1,15 @@
+// Contains the SmoothingBackend enum for Hand Detection, the ways PrepareImage can do its median and
+//  Gaussian blurs. The OpenCV blurs are the reference, the others trade some agreement with them for speed.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#pragma once
+#include "Hand.h"
+
+enum SmoothingBackend {
+	OPENCV_SMOOTHING,			// medianBlur and GaussianBlur
+	HISTOGRAM_MEDIAN_SMOOTHING,	// Constant time histogram median, then GaussianBlur
+	BOX_GAUSSIAN_SMOOTHING,		// medianBlur, then box blurs standing in for the Gaussian
+	FAST_SMOOTHING,				// Histogram median and box blurs
+	DOWNSCALED_SMOOTHING,		// The OpenCV blurs once on a half size copy, which is scaled back up
+	SMOOTHING_BACKENDS			// Number of backends
+};
@@ -0,0 +1,119 @@
+// Contains the registry and writers behind the stage timers for Hand Detection. Each thread's ring
+//  buffer is registered here the first time it times a stage, and is kept until the program ends so
+//  its events can still be written after the thread is gone. Compiles to nothing unless
+//  HAND_STAGE_TIMING is defined.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#include "StageTimer.h"
+
+#ifdef HAND_STAGE_TIMING
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdio.h>
+
+// Every thread's trace, in the order the threads first timed a stage
+struct StageTraceRegistry {
+	mutex lock;
+	vector<unique_ptr<StageTrace>> traces;
+};
+
+static StageTraceRegistry& TraceRegistry() {
+	static StageTraceRegistry registry;
+	return registry;
+}
+
+// RegisterStageTrace
+// Precondition: None
+// Postcondition: Returns a new trace with its ring buffer allocated, numbered after the ones before it
+StageTrace* RegisterStageTrace() {
+	StageTraceRegistry& registry = TraceRegistry();
+	unique_ptr<StageTrace> trace(new StageTrace());
+	trace->events.resize(stage_trace_events);
+	lock_guard<mutex> guard(registry.lock);
+	trace->thread_id = (int)registry.traces.size();
+	registry.traces.push_back(move(trace));
+	return registry.traces.back().get();
+}
+
+// Calls visit(trace, event) for every event still in the ring buffers, oldest first per thread
+template <typename Visit>
+static void ForEachStageEvent(const Visit& visit) {
+	StageTraceRegistry& registry = TraceRegistry();
+	lock_guard<mutex> guard(registry.lock);
+	for (size_t t = 0; t < registry.traces.size(); t++) {
+		const StageTrace& trace = *registry.traces[t];
+		int64 const first = max<int64>(0, trace.recorded - stage_trace_events);
+		for (int64 i = first; i < trace.recorded; i++) {
+			visit(trace, trace.events[i % stage_trace_events]);
+		}
+	}
+}
+
+// WriteChromeTrace
+// Precondition: No thread is still timing stages
+// Postcondition: Writes every recorded event to file in Chrome's trace event format, one complete
+//                event per stage run with its frame, times in microseconds from the first event.
+//                Returns false if file could not be written.
+bool WriteChromeTrace(const string& file) {
+	FILE* out = fopen(file.c_str(), "w");
+	if (out == nullptr) return false;
+
+	int64 origin = INT64_MAX;
+	int threads = 0;
+	ForEachStageEvent([&](const StageTrace& trace, const StageEvent& event) {
+		origin = min(origin, event.start);
+		threads = max(threads, trace.thread_id + 1);
+	});
+	double const us_per_tick = 1e6 / getTickFrequency();
+
+	fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	bool first = true;
+	for (int t = 0; t < threads; t++) {
+		fprintf(out, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}",
+			first ? "" : ",\n", t, t);
+		first = false;
+	}
+	ForEachStageEvent([&](const StageTrace& trace, const StageEvent& event) {
+		fprintf(out, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,"
+			"\"args\":{\"frame\":%d}}", first ? "" : ",\n", event.stage, trace.thread_id,
+			(event.start - origin) * us_per_tick, (event.end - event.start) * us_per_tick, event.frame);
+		first = false;
+	});
+	fprintf(out, "\n]}\n");
+	return fclose(out) == 0;
+}
+
+// WriteStageSummary
+// Precondition: No thread is still timing stages
+// Postcondition: Writes one CSV row per stage to file with how many times it ran, its total, mean,
+//                median, 95th percentile and longest time in milliseconds, and its share of the time
+//                spent in all stages. Returns false if file could not be written.
+bool WriteStageSummary(const string& file) {
+	map<string, vector<double>> times;
+	double all_ms = 0;
+	double const ms_per_tick = 1000.0 / getTickFrequency();
+	ForEachStageEvent([&](const StageTrace&, const StageEvent& event) {
+		double const ms = (event.end - event.start) * ms_per_tick;
+		times[event.stage].push_back(ms);
+		all_ms += ms;
+	});
+
+	FILE* out = fopen(file.c_str(), "w");
+	if (out == nullptr) return false;
+	fprintf(out, "stage,count,total_ms,mean_ms,median_ms,p95_ms,max_ms,share_percent\n");
+	for (map<string, vector<double>>::iterator it = times.begin(); it != times.end(); ++it) {
+		vector<double>& samples = it->second;
+		sort(samples.begin(), samples.end());
+		double total = 0;
+		for (size_t i = 0; i < samples.size(); i++) total += samples[i];
+		size_t const count = samples.size();
+		fprintf(out, "%s,%d,%.3f,%.4f,%.4f,%.4f,%.4f,%.2f\n", it->first.c_str(), (int)count, total,
+			total / count, samples[count / 2], samples[min(count - 1, count * 95 / 100)], samples.back(),
+			all_ms > 0 ? 100.0 * total / all_ms : 0);
+	}
+	return fclose(out) == 0;
+}
+#endif
@@ -0,0 +1,71 @@
+// Contains the stage timers for Hand Detection. STAGE_TIMER at the top of a block records how long the
+//  block took into a ring buffer owned by the thread running it, nothing is shared or locked while
+//  timing. The buffers can afterwards be written as a Chrome trace (chrome://tracing or Perfetto) and
+//  as a per stage CSV summary. The timers only exist when HAND_STAGE_TIMING is defined, otherwise
+//  STAGE_TIMER and STAGE_FRAME expand to nothing. When allocations are counted STAGE_TIMER also
+//  counts the block's allocations under the same stage name.
+// Author: Quintin Nguyen, Akhil Lal, Matthew Cho
+
+#pragma once
+#include "Hand.h"
+#include "AllocationCounter.h"
+
+#ifdef HAND_STAGE_TIMING
+int const stage_trace_events = 1 << 17;	// Events kept per thread, the oldest are overwritten after that
+
+struct StageEvent {
+	const char* stage;		// Must outlive the trace, a string literal
+	int frame;
+	int64 start;			// getTickCount ticks
+	int64 end;
+};
+
+struct StageTrace {
+	vector<StageEvent> events;	// stage_trace_events long, filled as a ring
+	int64 recorded = 0;			// Events ever recorded, the next one goes at recorded % stage_trace_events
+	int thread_id = 0;
+	int frame = -1;				// Frame the thread's events belong to
+};
+
+StageTrace* RegisterStageTrace();
+
+// ThreadStageTrace
+// Precondition: None
+// Postcondition: Returns the calling thread's trace, registering it the first time
+inline StageTrace& ThreadStageTrace() {
+	thread_local StageTrace* const trace = RegisterStageTrace();
+	return *trace;
+}
+
+// Records the time between its construction and destruction as one event of stage
+class StageTimer {
+public:
+	explicit StageTimer(const char* stage) : stage(stage), start(getTickCount()) {}
+
+	~StageTimer() {
+		int64 const end = getTickCount();
+		StageTrace& trace = ThreadStageTrace();
+		StageEvent& event = trace.events[trace.recorded % stage_trace_events];
+		event.stage = stage;
+		event.frame = trace.frame;
+		event.start = start;
+		event.end = end;
+		trace.recorded++;
+	}
+
+private:
+	const char* const stage;
+	int64 const start;
+};
+
+bool WriteChromeTrace(const string& file);
+bool WriteStageSummary(const string& file);
+
+#define STAGE_TIMER_NAME(line) stage_timer_##line
+#define STAGE_TIMER_AT(line) STAGE_TIMER_NAME(line)
+#define STAGE_TIMER(stage) StageTimer STAGE_TIMER_AT(__LINE__)(stage); STAGE_ALLOCATIONS(stage)
+#define STAGE_FRAME(index) (ThreadStageTrace().frame = (index))
+#else
+#define STAGE_TIMER(stage) STAGE_ALLOCATIONS(stage)
+#define STAGE_FRAME(index)
+#endif